@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - AlignedAllocator.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [8:20 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef ALIGNEDALLOCATOR_HPP
+#define ALIGNEDALLOCATOR_HPP
+
+#include <new>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace maths
+{
+    /**
+     * Standard allocator returning storage aligned on the given boundary
+     * (a cache line by default), allowing aligned SIMD loads and stores
+     *
+     * @tparam T            Allocated type
+     * @tparam Alignment    Alignment in bytes, a power of 2
+     */
+    template < class T, size_t Alignment = 64 >
+    class AlignedAllocator
+    {
+        static_assert(Alignment && !(Alignment & (Alignment - 1)), "alignment must be a power of 2");
+        static_assert(Alignment >= alignof(void*), "alignment must at least be the one of pointers");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        template < class U >
+        struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+        static constexpr size_t alignment = Alignment;
+
+        AlignedAllocator() noexcept = default;
+
+        template < class U >
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        /**
+         * Allocates uninitialized storage for the given amount of elements.
+         * The original address is kept right before the aligned block
+         *
+         * @param count                 Amount of elements
+         * @return                      Aligned storage
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        T* allocate(const size_type& count)
+        {
+            if (count > (std::numeric_limits<size_type>::max() - Alignment - sizeof(void*)) / sizeof(T))
+                throw std::bad_alloc();
+            void* raw = ::operator new(count * sizeof(T) + Alignment + sizeof(void*));
+
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+            void* aligned = reinterpret_cast<void*>((address + Alignment - 1) & ~static_cast<std::uintptr_t>(Alignment - 1));
+            static_cast<void**>(aligned)[-1] = raw;
+            return static_cast<T*>(aligned);
+        }
+
+        /**
+         * Releases storage obtained from `allocate`
+         *
+         * @param data                  Storage to release
+         */
+        void deallocate(T* data, const size_type&) noexcept
+        {
+            if (data)
+                ::operator delete(reinterpret_cast<void**>(data)[-1]);
+        }
+    };
+
+    template < class T, size_t Alignment >
+    constexpr size_t AlignedAllocator<T, Alignment>::alignment;
+
+    template < class T, class U, size_t Alignment >
+    bool operator==(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) noexcept
+        { return true; }
+
+    template < class T, class U, size_t Alignment >
+    bool operator!=(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) noexcept
+        { return false; }
+
+    /**
+     * Aligned allocator which also requests matrices to pad each of their rows
+     * to a multiple of the alignment, so that every row starts on a boundary
+     *
+     * @tparam T            Allocated type
+     * @tparam Alignment    Alignment in bytes, a power of 2
+     */
+    template < class T, size_t Alignment = 64 >
+    class PaddedAllocator: public AlignedAllocator<T, Alignment>
+    {
+    public:
+        template < class U >
+        struct rebind { using other = PaddedAllocator<U, Alignment>; };
+
+        PaddedAllocator() noexcept = default;
+
+        template < class U >
+        PaddedAllocator(const PaddedAllocator<U, Alignment>&) noexcept {}
+    };
+
+    /**
+     * Amount of bytes matrices built on the allocator pad their rows to
+     * (0 for no padding, rows being stored contiguously)
+     *
+     * @tparam A    Allocator type
+     */
+    template < class A >
+    struct row_padding: std::integral_constant<size_t, 0> {};
+
+    template < class T, size_t Alignment >
+    struct row_padding<PaddedAllocator<T, Alignment>>: std::integral_constant<size_t, Alignment> {};
+}
+
+#endif //ALIGNEDALLOCATOR_HPP
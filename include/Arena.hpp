@@ -0,0 +1,456 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - Arena.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [9:40 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <new>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace maths
+{
+    /**
+     * Bump allocator for scratch buffers, released all at once by rewinding
+     * to a previous position (see Arena::Scope). Every thread owns one
+     * (see Arena::local()), and callers may bind their own workspace instead
+     * (see Arena::Bind). Once its blocks are large enough for a workload,
+     * an arena serves it without any heap allocation
+     *
+     * An arena is not thread-safe: it must only be used by one thread at a time
+     */
+    class Arena
+    {
+    public:
+        using size_type = size_t;
+
+        // Size of the first block allocated by an arena without workspace
+        static constexpr size_type MIN_BLOCK = 64 * 1024;
+
+        // Default alignment of the allocations, a cache line
+        static constexpr size_type ALIGNMENT = 64;
+
+        /**
+         * Position within an arena, to rewind it to
+         */
+        struct Marker
+        {
+            size_type block;
+            size_type offset;
+        };
+
+        /**
+         * Rewinds an arena on destruction to its position on construction,
+         * releasing everything allocated in between
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(Arena& arena = Arena::current()) noexcept:
+                _arena(arena), _marker(arena.mark()) {}
+            ~Scope() { this->_arena.rewind(this->_marker); }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            Arena&  _arena;     // Rewound arena
+            Marker  _marker;    // Position to rewind to
+        };
+
+        /**
+         * Binds an arena as the current one of the calling thread, in place of
+         * its own, until destruction (other threads are unaffected)
+         */
+        class Bind
+        {
+        public:
+            explicit Bind(Arena& arena) noexcept:
+                _previous(Arena::_current())
+                { Arena::_current() = &arena; }
+            ~Bind() { Arena::_current() = this->_previous; }
+
+            Bind(const Bind&) = delete;
+            Bind& operator=(const Bind&) = delete;
+
+        private:
+            Arena * _previous;  // Arena bound beforehand, if any
+        };
+
+        /**
+         * Constructs an empty arena, which allocates its blocks on demand
+         */
+        Arena() noexcept:
+            _blocks(), _block(0), _offset(0) {}
+
+        /**
+         * Constructs an arena with a first block of the given size
+         *
+         * @param bytes                 Size of the first block
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        explicit Arena(const size_type& bytes):
+            Arena()
+        {
+            if (bytes)
+                this->_grow(bytes);
+            this->_block = 0;
+        }
+
+        /**
+         * Constructs an arena over a caller-supplied workspace, which is used
+         * first and never released. Blocks are still allocated once it is full
+         *
+         * @param workspace             Workspace to allocate from
+         * @param bytes                 Size of the workspace
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        Arena(void * workspace, const size_type& bytes):
+            Arena()
+        {
+            if (workspace && bytes)
+                this->_blocks.push_back({ static_cast<char*>(workspace), bytes, false });
+        }
+
+        ~Arena()
+        {
+            for (const Block& block : this->_blocks)
+                if (block.owned)
+                    ::operator delete(block.data);
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * Retrieves the arena owned by the calling thread
+         *
+         * @return                      Thread-local arena
+         */
+        static Arena& local() noexcept
+        {
+            static thread_local Arena arena;
+            return arena;
+        }
+
+        /**
+         * Retrieves the arena currently bound to the calling thread,
+         * or its own if none is
+         *
+         * @return                      Current arena
+         */
+        static Arena& current() noexcept
+        {
+            Arena * arena = Arena::_current();
+            return arena ? *arena : Arena::local();
+        }
+
+        /**
+         * Allocates uninitialized storage, valid until the arena
+         * is rewound before it
+         *
+         * @param bytes                 Size of the storage
+         * @param alignment             Alignment of the storage, a power of 2
+         * @return                      Allocated storage
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        void* allocate(const size_type& bytes, size_type alignment = ALIGNMENT)
+        {
+            if (bytes > std::numeric_limits<size_type>::max() / 2 - alignment)
+                throw std::bad_alloc();
+            for (;;)
+            {
+                if (this->_block < this->_blocks.size())
+                {
+                    const Block& block = this->_blocks[this->_block];
+                    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data);
+                    const size_type start = ((base + this->_offset + alignment - 1)
+                                            & ~static_cast<std::uintptr_t>(alignment - 1)) - base;
+                    if (start <= block.size && bytes <= block.size - start)
+                    {
+                        this->_offset = start + bytes;
+                        return block.data + start;
+                    }
+                    if (this->_block + 1 < this->_blocks.size())
+                    {
+                        ++this->_block;
+                        this->_offset = 0;
+                        continue;
+                    }
+                }
+                this->_grow(bytes + alignment);
+            }
+        }
+
+        /**
+         * Releases storage right away when it is the latest allocation,
+         * otherwise leaves it to the next rewind
+         *
+         * @param data                  Storage to release
+         * @param bytes                 Size of the storage
+         */
+        void deallocate(void * data, const size_type& bytes) noexcept
+        {
+            if (this->_block >= this->_blocks.size())
+                return;
+            char * top = this->_blocks[this->_block].data + this->_offset;
+            if (static_cast<char*>(data) + bytes == top)
+                this->_offset -= bytes;
+        }
+
+        /**
+         * Retrieves the current position of the arena
+         *
+         * @return                      Position to rewind to
+         */
+        Marker mark() const noexcept
+            { return { this->_block, this->_offset }; }
+
+        /**
+         * Rewinds the arena to a previous position, releasing everything
+         * allocated since. Rewinding it to its start also merges its blocks
+         * into one, which is large enough for the next time
+         *
+         * @param marker                Position to rewind to
+         */
+        void rewind(const Marker& marker) noexcept
+        {
+            this->_block = marker.block;
+            this->_offset = marker.offset;
+            if (!this->_block && !this->_offset)
+                this->_coalesce();
+        }
+
+        /**
+         * Retrieves the amount of bytes currently allocated
+         * (including alignment padding and skipped space)
+         *
+         * @return                      Allocated bytes
+         */
+        size_type used() const noexcept
+        {
+            size_type result = this->_offset;
+            for (size_type i = 0; i < this->_block && i < this->_blocks.size(); ++i)
+                result += this->_blocks[i].size;
+            return result;
+        }
+
+        /**
+         * Retrieves the total size of the blocks of the arena
+         *
+         * @return                      Capacity in bytes
+         */
+        size_type capacity() const noexcept
+        {
+            size_type result = 0;
+            for (const Block& block : this->_blocks)
+                result += block.size;
+            return result;
+        }
+
+    private:
+        struct Block
+        {
+            char *      data;   // Storage
+            size_type   size;   // Size of the storage
+            bool        owned;  // TRUE if allocated by the arena
+        };
+
+        static Arena*& _current() noexcept
+        {
+            static thread_local Arena * arena = nullptr;
+            return arena;
+        }
+
+        /**
+         * Appends a block of at least the given size, growing geometrically,
+         * and moves onto it
+         */
+        void _grow(const size_type& bytes)
+        {
+            size_type size = this->capacity();
+            if (size < MIN_BLOCK)
+                size = MIN_BLOCK;
+            if (size < bytes)
+                size = bytes;
+            this->_blocks.reserve(this->_blocks.size() + 1);
+            this->_blocks.push_back({ static_cast<char*>(::operator new(size)), size, true });
+            this->_block = this->_blocks.size() - 1;
+            this->_offset = 0;
+        }
+
+        /**
+         * Merges the owned blocks of an unused arena into a single one
+         */
+        void _coalesce() noexcept
+        {
+            size_type owned = 0, total = 0;
+            for (const Block& block : this->_blocks)
+                if (block.owned)
+                {
+                    ++owned;
+                    total += block.size;
+                }
+            if (owned < 2)
+                return;
+
+            void * data = ::operator new(total, std::nothrow);
+            if (!data)
+                return;
+            size_type kept = 0;
+            for (size_type i = 0; i < this->_blocks.size(); ++i)
+            {
+                if (this->_blocks[i].owned)
+                    ::operator delete(this->_blocks[i].data);
+                else
+                    this->_blocks[kept++] = this->_blocks[i];
+            }
+            this->_blocks.resize(kept);
+            this->_blocks.push_back({ static_cast<char*>(data), total, true });
+        }
+
+        std::vector<Block>  _blocks;    // Storage blocks, used in order
+        size_type           _block;     // Block currently allocated from
+        size_type           _offset;    // Position within the current block
+    };
+
+    /**
+     * Allocator drawing from an arena (the current one of the constructing
+     * thread by default). Containers using it must not outlive the scope
+     * their storage was allocated in
+     *
+     * @tparam T            Allocated type
+     */
+    template < class T >
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template < class U >
+        struct rebind { using other = ArenaAllocator<U>; };
+
+        ArenaAllocator() noexcept:
+            _arena(&Arena::current()) {}
+
+        explicit ArenaAllocator(Arena& arena) noexcept:
+            _arena(&arena) {}
+
+        template < class U >
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept:
+            _arena(&other.arena()) {}
+
+        /**
+         * Allocates uninitialized storage for the given amount of elements
+         *
+         * @param count                 Amount of elements
+         * @return                      Storage aligned on a cache line
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        T* allocate(const size_type& count)
+        {
+            if (count > std::numeric_limits<size_type>::max() / sizeof(T))
+                throw std::bad_alloc();
+            constexpr size_type alignment = alignof(T) > Arena::ALIGNMENT ? alignof(T) : Arena::ALIGNMENT;
+            return static_cast<T*>(this->_arena->allocate(count * sizeof(T), alignment));
+        }
+
+        void deallocate(T* data, const size_type& count) noexcept
+            { this->_arena->deallocate(data, count * sizeof(T)); }
+
+        /**
+         * Retrieves the arena allocated from
+         */
+        Arena& arena() const noexcept
+            { return *this->_arena; }
+
+    private:
+        Arena * _arena; // Arena allocated from
+    };
+
+    template < class T, class U >
+    bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+        { return &lhs.arena() == &rhs.arena(); }
+
+    template < class T, class U >
+    bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+        { return !(lhs == rhs); }
+
+    /**
+     * Scratch array of default-initialized elements taken from an arena,
+     * rewinding it on destruction: instances must be destroyed in reverse
+     * order of construction, as local variables are
+     *
+     * @tparam T            Element type
+     */
+    template < class T >
+    class Scratch
+    {
+    public:
+        /**
+         * Allocates the scratch array
+         *
+         * @param count                 Amount of elements
+         * @param arena                 Arena to allocate from
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        explicit Scratch(const size_t& count, Arena& arena = Arena::current()):
+            _scope(arena), _data(ArenaAllocator<T>(arena).allocate(count)), _count(0)
+        {
+            try
+            {
+                for (; this->_count < count; ++this->_count)
+                    ::new (static_cast<void*>(this->_data + this->_count)) T;
+            }
+            catch (...)
+            {
+                while (this->_count)
+                    this->_data[--this->_count].~T();
+                throw;
+            }
+        }
+
+        ~Scratch()
+        {
+            while (this->_count)
+                this->_data[--this->_count].~T();
+        }
+
+        Scratch(const Scratch&) = delete;
+        Scratch& operator=(const Scratch&) = delete;
+
+        T* get() const noexcept
+            { return this->_data; }
+
+        T& operator[](const size_t& i) const noexcept
+            { return this->_data[i]; }
+
+    private:
+        Arena::Scope    _scope; // Releases the storage
+        T *             _data;  // Elements
+        size_t          _count; // Amount of constructed elements
+    };
+}
+
+#endif //ARENA_HPP
@@ -0,0 +1,470 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - BandMatrix.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [5:15 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef BANDMATRIX_HPP
+#define BANDMATRIX_HPP
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+#include "general.hpp"
+#include "AlignedAllocator.hpp"
+#include "TriangularMatrix.hpp"
+
+template < class K >
+class BandLU;
+
+/**
+ * Banded square matrix, whose values lie within `lower()` diagonals below the
+ * main one and `upper()` above it, such as the stencils of discretized PDEs.
+ * Only the band is stored, row by row, and products go through it alone
+ *
+ * @tparam K        Matrix inner working type
+ */
+template < class K >
+class BandMatrix
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using storage_type = std::vector<K, maths::AlignedAllocator<K>>;
+
+    BandMatrix() = delete;
+    ~BandMatrix() = default;
+
+    /**
+     * Constructs a new matrix of given size and bandwidths, the band being
+     * filled with a value
+     *
+     * @param size                  Height and width of the matrix
+     * @param lower                 Amount of diagonals below the main one
+     * @param upper                 Amount of diagonals above the main one
+     * @param value                 Value of the band
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    BandMatrix(const size_type& size, const size_type& lower, const size_type& upper,
+               const value_type& value = value_type()):
+        _size(size), _lower(lower), _upper(upper), _values(size * (lower + upper + 1), value) {}
+
+    /**
+     * Constructs a new matrix from the band of a dense one,
+     * ignoring the values outside of it
+     *
+     * @param other                 Square matrix to copy from
+     * @param lower                 Amount of diagonals below the main one
+     * @param upper                 Amount of diagonals above the main one
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    BandMatrix(const Matrix<K, A>& other, const size_type& lower, const size_type& upper):
+        BandMatrix(other.height(), lower, upper)
+    {
+        if (!other.square())
+            throw std::logic_error("band matrices can only be built from a square matrix");
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = this->first(m); n < this->last(m); ++n)
+                (*this)(m, n) = other[{ m, n }];
+    }
+
+    /**
+     * Retrieves the value at the given position, zero outside of the band
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    value_type at(const size_type& m, const size_type& n) const
+    {
+        if (m >= this->_size || n >= this->_size)
+            throw std::out_of_range("position is out of range");
+        if (!this->stored(m, n))
+            return value_type();
+        return (*this)(m, n);
+    }
+
+    /**
+     * Retrieves the stored value at the given position
+     * (Caution: does not check the position lies within the band)
+     */
+    value_type& operator()(const size_type& m, const size_type& n) noexcept
+        { return this->_values[m * this->bandwidth() + n + this->_lower - m]; }
+
+    const value_type& operator()(const size_type& m, const size_type& n) const noexcept
+        { return this->_values[m * this->bandwidth() + n + this->_lower - m]; }
+
+    /**
+     * Checks whether the given position lies within the band
+     */
+    constexpr bool stored(const size_type& m, const size_type& n) const noexcept
+        { return n + this->_lower >= m && n <= m + this->_upper; }
+
+    /**
+     * First and past-the-last columns of the band on a row
+     */
+    constexpr size_type first(const size_type& m) const noexcept
+        { return m > this->_lower ? m - this->_lower : 0; }
+
+    size_type last(const size_type& m) const noexcept
+        { return std::min(this->_size, m + this->_upper + 1); }
+
+    constexpr shape_type shape() const noexcept
+        { return { this->_size, this->_size }; }
+
+    constexpr size_type height() const noexcept
+        { return this->_size; }
+
+    constexpr size_type width() const noexcept
+        { return this->_size; }
+
+    constexpr size_type size() const noexcept
+        { return this->_size; }
+
+    constexpr size_type lower() const noexcept
+        { return this->_lower; }
+
+    constexpr size_type upper() const noexcept
+        { return this->_upper; }
+
+    /**
+     * Retrieves the amount of values stored per row
+     */
+    constexpr size_type bandwidth() const noexcept
+        { return this->_lower + this->_upper + 1; }
+
+    /**
+     * Creates the dense matrix holding the same values
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> to_matrix() const
+    {
+        Matrix<K> result(this->_size, this->_size);
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = this->first(m); n < this->last(m); ++n)
+                result[{ m, n }] = (*this)(m, n);
+        return result;
+    }
+
+    /**
+     * Calculates the product with a vector
+     *
+     * @param rhs                   Vector or view to multiply with
+     * @return                      New vector containing the result
+     *
+     * @exception std::logic_error  Given vector doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Vector<K> operator*(const VectorView<const K>& rhs) const
+    {
+        if (this->_size != rhs.size())
+            throw std::logic_error("incompatible for multiplication");
+        Vector<K> result(this->_size);
+        for (size_type m = 0; m < this->_size; ++m)
+        {
+            value_type sum = value_type();
+            for (size_type n = this->first(m); n < this->last(m); ++n)
+                sum = maths::fma((*this)(m, n), rhs[n], sum);
+            result[m] = sum;
+        }
+        return result;
+    }
+
+    /**
+     * Calculates the product with a dense matrix
+     *
+     * @param rhs                   Matrix or view to multiply with
+     * @return                      New matrix containing the result
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> operator*(const MatrixView<const K>& rhs) const
+    {
+        if (this->_size != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+        Matrix<K> result(this->_size, rhs.width());
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = this->first(m); n < this->last(m); ++n)
+                maths::packed::axpy(rhs.width(), (*this)(m, n), rhs.data() + n * rhs.stride(),
+                                    result.data() + m * result.stride());
+        return result;
+    }
+
+    /**
+     * Calculates the banded LU factorization of the matrix (see BandLU)
+     *
+     * @return                      Factorization of the matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    BandLU<K> lu() const
+        { return BandLU<K>(*this); }
+
+private:
+    size_type       _size;      // Height and width of the matrix
+    size_type       _lower;     // Diagonals below the main one
+    size_type       _upper;     // Diagonals above the main one
+    storage_type    _values;    // Band, row by row
+};
+
+/**
+ * LU factorization with partial pivoting, denoted `PA = LU`, of a band matrix,
+ * in O(n * lower * (lower + upper)) operations instead of O(n^3). Row
+ * interchanges widen the upper band of U to `lower + upper` diagonals, which
+ * are kept in the same banded layout
+ *
+ * @tparam K        Matrix inner working type
+ */
+template < class K >
+class BandLU
+{
+    static_assert(maths::is_field<K>::value, "band LU factorization requires exact divisions");
+
+public:
+    using value_type = K;
+    using size_type = size_t;
+
+    BandLU() = delete;
+    ~BandLU() = default;
+
+    /**
+     * Factorizes the given band matrix. Singular matrices are still factorized,
+     * but leave a negligible value on the diagonal of U
+     *
+     * @param matrix                Band matrix to factorize
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit BandLU(const BandMatrix<K>& matrix):
+        _factors(matrix.size(), matrix.lower(), matrix.lower() + matrix.upper()),
+        _pivots(matrix.size()), _swaps(0), _singular(false), _deficient(false)
+    {
+        const size_type n = matrix.size();
+        value_type largest = value_type();
+        for (size_type m = 0; m < n; ++m)
+            for (size_type c = matrix.first(m); c < matrix.last(m); ++c)
+            {
+                this->_factors(m, c) = matrix(m, c);
+                largest = std::max(largest, _magnitude(matrix(m, c)));
+            }
+        const value_type tolerance = std::numeric_limits<value_type>::epsilon() * static_cast<value_type>(n) * largest;
+
+        BandMatrix<K>& a = this->_factors;
+        for (size_type k = 0; k < n; ++k)
+        {
+            const size_type rows = std::min(n, k + matrix.lower() + 1);
+            size_type pivot = k;
+            for (size_type i = k + 1; i < rows; ++i)
+                if (_magnitude(a(pivot, k)) < _magnitude(a(i, k)))
+                    pivot = i;
+            this->_pivots[k] = pivot;
+            if (!(tolerance < _magnitude(a(pivot, k))))
+                this->_singular = true;
+            if (a(pivot, k) == value_type())
+            {
+                this->_deficient = true;
+                continue;
+            }
+
+            const size_type columns = a.last(k);
+            if (pivot != k)
+            {
+                ++this->_swaps;
+                for (size_type c = k; c < columns; ++c)
+                    std::swap(a(k, c), a(pivot, c));
+            }
+            for (size_type i = k + 1; i < rows; ++i)
+            {
+                const value_type factor = a(i, k) / a(k, k);
+                a(i, k) = factor;
+                for (size_type c = k + 1; c < columns; ++c)
+                    a(i, c) = maths::fma(-factor, a(k, c), a(i, c));
+            }
+        }
+    }
+
+    /**
+     * Retrieves the factors: multipliers of L below the diagonal, in order of
+     * elimination (rows are not interchanged afterwards), and U on and above it
+     */
+    const BandMatrix<K>& factors() const noexcept
+        { return this->_factors; }
+
+    /**
+     * Retrieves the row interchanges: row `i` was swapped with row `pivots()[i]`
+     * before eliminating column `i`
+     */
+    const std::vector<size_type>& pivots() const noexcept
+        { return this->_pivots; }
+
+    size_type size() const noexcept
+        { return this->_factors.size(); }
+
+    /**
+     * Checks if the factorized matrix is numerically singular, having a pivot
+     * negligible before the rounding errors of the factorization
+     * (`n * epsilon * max(|A|)`). Only a query: the determinant and solutions
+     * are still calculated for such matrices
+     */
+    bool singular() const noexcept
+        { return this->_singular; }
+
+    /**
+     * Checks if the solutions can be calculated: no pivot is exactly zero
+     */
+    bool invertible() const noexcept
+        { return !this->_deficient; }
+
+    /**
+     * Calculates the determinant of the factorized matrix, denoted `det(A)`,
+     * as the signed product of U's diagonal, whatever the scale of the matrix:
+     * only an exactly zero pivot makes it 0
+     */
+    value_type determinant() const
+    {
+        if (this->_deficient)
+            return value_type();
+        value_type result = this->_swaps % 2 ? -1 : 1;
+        for (size_type i = 0; i < this->size(); ++i)
+            result *= this->_factors(i, i);
+        return result;
+    }
+
+    /**
+     * Solves the system `Ax = b`
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Vector<K> solve(const VectorView<const K>& rhs) const
+    {
+        Vector<K> result(rhs);
+        this->solve_inplace(result.view());
+        return result;
+    }
+
+    /**
+     * Solves the system `AX = B` for every column of B at once
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> solve(const MatrixView<const K>& rhs) const
+    {
+        Matrix<K> result(rhs);
+        this->solve_inplace(result.view());
+        return result;
+    }
+
+    /**
+     * Solves the system `Ax = b`, overwriting b with the solution
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     */
+    void solve_inplace(const VectorView<K>& rhs) const
+    {
+        if (rhs.size() != this->size())
+            throw std::logic_error("cannot solve with different matrix heights");
+        this->_substitute(rhs.data(), 1, rhs.step());
+    }
+
+    /**
+     * Solves the system `AX = B`, overwriting B with the solutions
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     */
+    void solve_inplace(const MatrixView<K>& rhs) const
+    {
+        if (rhs.height() != this->size())
+            throw std::logic_error("cannot solve with different matrix heights");
+        this->_substitute(rhs.data(), rhs.width(), rhs.stride());
+    }
+
+private:
+    static value_type _magnitude(const value_type& value)
+        { return value < value_type() ? -value : value; }
+
+    /**
+     * Applies the interchanges and eliminations of L column by column on a
+     * row-major block of right-hand sides, then substitutes U from the bottom
+     */
+    void _substitute(value_type * b, const size_type& width, const size_type& ldb) const
+    {
+        if (this->_deficient)
+            throw std::runtime_error("cannot solve a singular system");
+        const BandMatrix<K>& a = this->_factors;
+        const size_type n = this->size();
+
+        for (size_type k = 0; k < n; ++k)
+        {
+            if (this->_pivots[k] != k)
+                std::swap_ranges(b + k * ldb, b + k * ldb + width, b + this->_pivots[k] * ldb);
+            const size_type rows = std::min(n, k + a.lower() + 1);
+            for (size_type i = k + 1; i < rows; ++i)
+                maths::packed::axpy(width, -a(i, k), b + k * ldb, b + i * ldb);
+        }
+        for (size_type i = n; i--;)
+        {
+            value_type * row = b + i * ldb;
+            for (size_type c = i + 1; c < a.last(i); ++c)
+                maths::packed::axpy(width, -a(i, c), b + c * ldb, row);
+            const value_type diagonal = a(i, i);
+            for (size_type c = 0; c < width; ++c)
+                row[c] /= diagonal;
+        }
+    }
+
+    BandMatrix<K>           _factors;   // L multipliers and U, of widened upper band
+    std::vector<size_type>  _pivots;    // Row interchanges
+    size_type               _swaps;     // Amount of effective row interchanges
+    bool                    _singular;  // Whether a pivot is negligible
+    bool                    _deficient; // Whether a pivot is exactly zero
+};
+
+/**
+ * Solves the system `Ax = b` for a band matrix A, through its banded factorization
+ *
+ * @exception std::runtime_error A is singular
+ * @exception std::logic_error   b is not of A's height
+ * @exception std::bad_alloc     Allocation failure
+ */
+template < class K, class B >
+Vector<K> solve(const BandMatrix<K>& a, const Vector<K, B>& b)
+    { return a.lu().solve(b); }
+
+/**
+ * Solves the system `AX = B` for a band matrix A, through its banded factorization
+ *
+ * @exception std::runtime_error A is singular
+ * @exception std::logic_error   B is not of A's height
+ * @exception std::bad_alloc     Allocation failure
+ */
+template < class K, class B >
+Matrix<K> solve(const BandMatrix<K>& a, const Matrix<K, B>& b)
+    { return a.lu().solve(b); }
+
+/**
+ * Writes the matrix, with the zeros outside of the band
+ */
+template < class K >
+std::ostream& operator<<(std::ostream& out, const BandMatrix<K>& value)
+    { return out << value.to_matrix(); }
+
+#endif //BANDMATRIX_HPP
@@ -0,0 +1,597 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - BitMatrix.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [1:10 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef BITMATRIX_HPP
+#define BITMATRIX_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+#include "AlignedAllocator.hpp"
+#include "ThreadPool.hpp"
+#include "Matrix.hpp"
+
+/**
+ * Kernels of matrices over GF(2) packed into 64-bit words, row-major, with
+ * entry `(m, n)` at bit `n % 64` of word `n / 64` of row `m`. Bits past the
+ * width are kept at zero, so that whole words may be compared and counted
+ */
+namespace maths
+{
+namespace bits
+{
+    // Amount of bits per word
+    constexpr size_t WORD = 64;
+
+    // Rows are padded to multiples of this many words (a cache line)
+    constexpr size_t ALIGNMENT = 8;
+
+    // Amount of pivot rows combined by each table of the Method of Four Russians
+    constexpr size_t TABLE = 8;
+
+    // Amount of words multiplied at once, for the transposed operand to stay in cache
+    constexpr size_t CHUNK = 64;
+
+    /**
+     * Calculates the amount of words holding the given amount of bits
+     */
+    constexpr size_t words(const size_t& count) noexcept
+        { return (count + WORD - 1) / WORD; }
+
+    inline bool get(const uint64_t * row, const size_t& n) noexcept
+        { return (row[n / WORD] >> (n % WORD)) & 1; }
+
+    /**
+     * Adds (XOR) a row of words into another, from the given word on
+     */
+    inline void add(uint64_t * target, const uint64_t * source, const size_t& first, const size_t& last) noexcept
+    {
+        // Copied, since rows may alias size_t through uint64_t
+        const size_t end = last;
+        for (size_t w = first; w < end; ++w)
+            target[w] ^= source[w];
+    }
+
+    /**
+     * Transposes a 64x64 block of bits in place, by swapping ever smaller
+     * sub-blocks across the diagonal (32x32, then 16x16, down to single bits)
+     *
+     * @param block                 Rows of the block
+     */
+    inline void transpose_block(uint64_t * block) noexcept
+    {
+        uint64_t mask = 0x00000000FFFFFFFFull;
+        for (size_t j = 32; j; j >>= 1, mask ^= mask << j)
+            for (size_t k = 0; k < WORD; k = ((k | j) + 1) & ~j)
+            {
+                const uint64_t t = ((block[k] >> j) ^ block[k | j]) & mask;
+                block[k] ^= t << j;
+                block[k | j] ^= t;
+            }
+    }
+
+    /**
+     * Multiplies `a` by `b` through its transpose: entry `(i, j)` is the parity
+     * of the amount of bits shared by row `i` of `a` and row `j` of `bt`. As
+     * parities add up modulo 2, the ANDs of a whole row are XORed together
+     * before a single population count, and the chunks of words are summed
+     * into the result the same way
+     *
+     * @param height                Amount of rows of `a` and `c`
+     * @param width                 Amount of rows of `bt`, columns of `c`
+     * @param depth                 Amount of words of the rows of `a` and `bt`
+     * @param a                     Left operand
+     * @param lda                   Distance between two rows of `a`, in words
+     * @param bt                    Transpose of the right operand
+     * @param ldb                   Distance between two rows of `bt`, in words
+     * @param c                     Zeroed result
+     * @param ldc                   Distance between two rows of `c`, in words
+     */
+    inline void multiply(const size_t& height, const size_t& width, const size_t& depth,
+                         const uint64_t * a, const size_t& lda,
+                         const uint64_t * bt, const size_t& ldb,
+                         uint64_t * c, const size_t& ldc)
+    {
+        const size_t work = width * depth / WORD + 1;
+        ThreadPool::global().parallel_rows(0, height, work, [&](const size_t& first, const size_t& last) {
+            for (size_t kw = 0; kw < depth; kw += CHUNK)
+            {
+                const size_t kend = depth - kw < CHUNK ? depth : kw + CHUNK;
+                for (size_t jw = 0; jw < words(width); ++jw)
+                {
+                    const size_t count = width - jw * WORD < WORD ? width - jw * WORD : WORD;
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        const uint64_t * x = a + i * lda;
+                        uint64_t word = 0;
+                        for (size_t j = 0; j < count; ++j)
+                        {
+                            const uint64_t * y = bt + (jw * WORD + j) * ldb;
+                            uint64_t shared = 0;
+                            for (size_t w = kw; w < kend; ++w)
+                                shared ^= x[w] & y[w];
+                            word |= static_cast<uint64_t>(__builtin_popcountll(shared) & 1) << j;
+                        }
+                        c[i * ldc + jw] ^= word;
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * Eliminates a matrix in place with the Method of Four Russians (M4RI):
+     * pivots are searched a word of columns at a time and reduced among
+     * themselves, then all combinations of each group of TABLE pivot rows are
+     * tabulated, so that every other row is cleared on those columns with a
+     * single pass over it, one XOR per table, looked up from its bits at the
+     * pivot columns. Pivots end up on the leading rows, with zeros below
+     * them, and above them as well with `reduce`
+     *
+     * @param a                     Matrix to eliminate
+     * @param height                Amount of rows
+     * @param width                 Amount of columns
+     * @param lda                   Distance between two rows of `a`, in words
+     * @param reduce                Whether to clear above the pivots too
+     * @return                      Rank, the amount of pivots
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    inline size_t eliminate(uint64_t * a, const size_t& height, const size_t& width, const size_t& lda,
+                            const bool& reduce)
+    {
+        constexpr size_t ENTRIES = size_t(1) << TABLE;
+        const size_t last = words(width);
+        std::vector<uint64_t, maths::AlignedAllocator<uint64_t>> tables(WORD / TABLE * ENTRIES * last);
+        size_t rank = 0;
+
+        for (size_t first = 0; first < last && rank < height; ++first)
+        {
+            const size_t end = width - first * WORD < WORD ? width : (first + 1) * WORD;
+            size_t pivots[WORD];
+            size_t found = 0;
+
+            for (size_t n = first * WORD; n < end && rank + found < height; ++n)
+            {
+                // Bit of each row once reduced by the pivots found so far,
+                // which are reduced among themselves
+                size_t i = rank + found;
+                for (; i < height; ++i)
+                {
+                    const uint64_t word = a[i * lda + first];
+                    uint64_t reduced = word;
+                    for (size_t p = 0; p < found; ++p)
+                        if ((word >> (pivots[p] % WORD)) & 1)
+                            reduced ^= a[(rank + p) * lda + first];
+                    if ((reduced >> (n % WORD)) & 1)
+                        break;
+                }
+                if (i == height)
+                    continue;
+
+                // Rows left to eliminate are zero before this word
+                uint64_t * pivot = a + (rank + found) * lda;
+                if (i != rank + found)
+                    std::swap_ranges(pivot + first, pivot + last, a + i * lda + first);
+                for (size_t p = 0; p < found; ++p)
+                    if (get(pivot, pivots[p]))
+                        add(pivot, a + (rank + p) * lda, first, last);
+                for (size_t p = 0; p < found; ++p)
+                    if (get(a + (rank + p) * lda, n))
+                        add(a + (rank + p) * lda, pivot, first, last);
+                pivots[found++] = n;
+            }
+            if (!found)
+                continue;
+
+            // Every combination of each group of pivot rows, one XOR each
+            const size_t span = last - first;
+            const size_t groups = (found + TABLE - 1) / TABLE;
+            for (size_t g = 0; g < groups; ++g)
+            {
+                uint64_t * table = tables.data() + g * ENTRIES * span;
+                const size_t size = found - g * TABLE < TABLE ? found - g * TABLE : TABLE;
+                std::fill(table, table + span, 0);
+                for (size_t index = 1; index < (size_t(1) << size); ++index)
+                {
+                    uint64_t * entry = table + index * span;
+                    const uint64_t * rest = table + (index & (index - 1)) * span;
+                    const uint64_t * row = a + (rank + g * TABLE + __builtin_ctzll(index)) * lda + first;
+                    for (size_t w = 0; w < span; ++w)
+                        entry[w] = rest[w] ^ row[w];
+                }
+            }
+
+            const size_t skip = rank;
+            const auto clear = [&](const size_t& from, const size_t& to) {
+                const size_t count = span;
+                const uint64_t * base = tables.data();
+                for (size_t i = from; i < to; ++i)
+                {
+                    uint64_t * row = a + i * lda + first;
+                    const uint64_t word = row[0];
+                    if (!word || (i >= skip && i < skip + found))
+                        continue;
+                    size_t indices[WORD / TABLE] = {};
+                    for (size_t p = 0; p < found; ++p)
+                        indices[p / TABLE] |= static_cast<size_t>((word >> (pivots[p] % WORD)) & 1) << (p % TABLE);
+                    for (size_t g = 0; g < groups; ++g)
+                        if (indices[g])
+                        {
+                            const uint64_t * entry = base + (g * ENTRIES + indices[g]) * count;
+                            for (size_t w = 0; w < count; ++w)
+                                row[w] ^= entry[w];
+                        }
+                }
+            };
+            ThreadPool::global().parallel_rows(reduce ? 0 : rank + found, height, span, clear);
+            rank += found;
+        }
+        return rank;
+    }
+}
+}
+
+/**
+ * Matrix over GF(2), the field of bits where addition is XOR and product is
+ * AND, packed 64 entries per word: eight times as compact as `Matrix<bool>`,
+ * and 32 times as `Matrix<int>`. Rows are added with a XOR per word, products
+ * count shared bits (see maths::bits::multiply), and eliminations run the
+ * Method of Four Russians (see maths::bits::eliminate)
+ */
+class BitMatrix
+{
+public:
+    using value_type = bool;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using word_type = uint64_t;
+
+    /**
+     * Constructs a new zeroed matrix of given size
+     *
+     * @param height                Height of the matrix (usually denoted `m`)
+     * @param width                 Width of the matrix (usually denoted `n`)
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    BitMatrix(const size_type& height, const size_type& width):
+        _max_m(height), _max_n(width),
+        _stride((maths::bits::words(width) + maths::bits::ALIGNMENT - 1)
+                / maths::bits::ALIGNMENT * maths::bits::ALIGNMENT),
+        _data(height * this->_stride) {}
+
+    /**
+     * Constructs a new matrix from a dense one, non-zero values becoming ones
+     *
+     * @param other                 Dense matrix to pack
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K, class A >
+    explicit BitMatrix(const Matrix<K, A>& other):
+        BitMatrix(other.height(), other.width())
+    {
+        for (size_type m = 0; m < this->_max_m; ++m)
+            for (size_type n = 0; n < this->_max_n; ++n)
+                if (other.at(m, n) != K())
+                    this->flip(m, n);
+    }
+
+    BitMatrix(const BitMatrix& other) = default;
+    BitMatrix(BitMatrix&& other) noexcept = default;
+    BitMatrix& operator=(const BitMatrix& rhs) = default;
+    BitMatrix& operator=(BitMatrix&& rhs) noexcept = default;
+    ~BitMatrix() = default;
+
+    /**
+     * Constructs the identity matrix of given size
+     *
+     * @param size                  Height and width of the matrix
+     * @return                      Identity matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    static BitMatrix identity(const size_type& size)
+    {
+        BitMatrix result(size, size);
+        for (size_type i = 0; i < size; ++i)
+            result.flip(i, i);
+        return result;
+    }
+
+    bool operator==(const BitMatrix& rhs) const
+        { return this->shape() == rhs.shape() && this->_data == rhs._data; }
+
+    bool operator!=(const BitMatrix& rhs) const
+        { return !(*this == rhs); }
+
+    /**
+     * Retrieves the entry at the given position
+     *
+     * @param m                     Row of the entry
+     * @param n                     Column of the entry
+     * @return                      Entry at the position
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    bool at(const size_type& m, const size_type& n) const
+    {
+        this->_check(m, n);
+        return maths::bits::get(this->row(m), n);
+    }
+
+    /**
+     * Sets the entry at the given position
+     *
+     * @param m                     Row of the entry
+     * @param n                     Column of the entry
+     * @param value                 Value to set
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    void set(const size_type& m, const size_type& n, const bool& value)
+    {
+        if (this->at(m, n) != value)
+            this->flip(m, n);
+    }
+
+    /**
+     * Flips the entry at the given position
+     *
+     * @param m                     Row of the entry
+     * @param n                     Column of the entry
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    void flip(const size_type& m, const size_type& n)
+    {
+        this->_check(m, n);
+        this->row(m)[n / maths::bits::WORD] ^= word_type(1) << (n % maths::bits::WORD);
+    }
+
+    shape_type shape() const noexcept
+        { return { this->_max_m, this->_max_n }; }
+
+    size_type height() const noexcept
+        { return this->_max_m; }
+
+    size_type width() const noexcept
+        { return this->_max_n; }
+
+    bool square() const noexcept
+        { return this->_max_m == this->_max_n; }
+
+    /**
+     * Retrieves the distance between the starts of two consecutive rows
+     *
+     * @return                      Row stride, in words
+     */
+    size_type stride() const noexcept
+        { return this->_stride; }
+
+    /**
+     * Retrieves the words of a row, bits past the width being zero
+     *
+     * @param m                     Index of the row
+     * @return                      Pointer to the first word of the row
+     */
+    word_type * row(const size_type& m) noexcept
+        { return this->_data.data() + m * this->_stride; }
+
+    const word_type * row(const size_type& m) const noexcept
+        { return this->_data.data() + m * this->_stride; }
+
+    /**
+     * Counts the ones of the matrix
+     */
+    size_type count() const noexcept
+    {
+        size_type result = 0;
+        for (const word_type& word : this->_data)
+            result += __builtin_popcountll(word);
+        return result;
+    }
+
+    /**
+     * Creates the dense matrix holding the same entries, as zeros and ones
+     *
+     * @tparam K                    Value type of the dense matrix
+     * @return                      Dense matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K = int >
+    Matrix<K> to_matrix() const
+    {
+        Matrix<K> result(this->_max_m, this->_max_n);
+        for (size_type m = 0; m < this->_max_m; ++m)
+            for (size_type n = 0; n < this->_max_n; ++n)
+                if (maths::bits::get(this->row(m), n))
+                    result.at(m, n) = K(1);
+        return result;
+    }
+
+    /**
+     * Swaps two rows, word by word
+     *
+     * @param a                     Index of first row
+     * @param b                     Index of second row
+     */
+    void swap_rows(const size_type& a, const size_type& b) noexcept
+        { std::swap_ranges(this->row(a), this->row(a) + this->_stride, this->row(b)); }
+
+    /**
+     * Adds a row into another, the only combination of rows over GF(2)
+     * (the counterpart of Matrix.fma_row()), by XORing their words
+     *
+     * @param a                     Index of the row to add into
+     * @param b                     Index of the row to add
+     */
+    void xor_row(const size_type& a, const size_type& b) noexcept
+        { maths::bits::add(this->row(a), this->row(b), 0, this->_stride); }
+
+    /**
+     * Creates the transpose of the matrix, by blocks of 64x64 bits
+     *
+     * @return                      Transposed matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    BitMatrix transpose() const
+    {
+        constexpr size_type WORD = maths::bits::WORD;
+        BitMatrix result(this->_max_n, this->_max_m);
+        word_type block[WORD];
+        for (size_type bm = 0; bm < maths::bits::words(this->_max_m); ++bm)
+            for (size_type bn = 0; bn < maths::bits::words(this->_max_n); ++bn)
+            {
+                for (size_type i = 0; i < WORD; ++i)
+                    block[i] = bm * WORD + i < this->_max_m ? this->row(bm * WORD + i)[bn] : 0;
+                maths::bits::transpose_block(block);
+                for (size_type i = 0; i < WORD && bn * WORD + i < this->_max_n; ++i)
+                    result.row(bn * WORD + i)[bm] = block[i];
+            }
+        return result;
+    }
+
+    /**
+     * Adds another matrix of the same shape, by XORing their words
+     *
+     * @param rhs                   Matrix to add
+     * @return                      This matrix
+     *
+     * @exception std::logic_error  Matrices are of different shapes
+     */
+    BitMatrix& operator+=(const BitMatrix& rhs)
+    {
+        if (this->shape() != rhs.shape())
+            throw std::logic_error("cannot operate on matrices of different shapes");
+        maths::bits::add(this->_data.data(), rhs._data.data(), 0, this->_data.size());
+        return *this;
+    }
+
+    BitMatrix operator+(const BitMatrix& rhs) const
+        { return BitMatrix(*this) += rhs; }
+
+    /**
+     * Calculates the product with another matrix, through the transpose of
+     * the right operand (see maths::bits::multiply). Products by a single
+     * column, such as syndromes of a parity-check matrix, cost a row each
+     *
+     * @param rhs                   Matrix to multiply with
+     * @return                      New matrix containing the result
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    BitMatrix operator*(const BitMatrix& rhs) const
+    {
+        if (this->_max_n != rhs._max_m)
+            throw std::logic_error("incompatible for multiplication");
+
+        const BitMatrix bt = rhs.transpose();
+        BitMatrix result(this->_max_m, rhs._max_n);
+        maths::bits::multiply(this->_max_m, rhs._max_n, maths::bits::words(this->_max_n),
+                              this->_data.data(), this->_stride,
+                              bt._data.data(), bt._stride,
+                              result._data.data(), result._stride);
+        return result;
+    }
+
+    /**
+     * Calculates the Reduced Row Echelon Form over GF(2)
+     * and applies on the current matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    void row_echelon_inplace()
+        { maths::bits::eliminate(this->_data.data(), this->_max_m, this->_max_n, this->_stride, true); }
+
+    /**
+     * Calculates the Reduced Row Echelon Form over GF(2)
+     * and returns it as a new matrix
+     *
+     * @return                      Result of Row echelon
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    BitMatrix row_echelon() const
+    {
+        BitMatrix tmp = *this;
+        tmp.row_echelon_inplace();
+        return tmp;
+    }
+
+    /**
+     * Calculates the rank of the matrix over GF(2)
+     *
+     * @return                      Rank of current matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    size_type rank() const
+    {
+        BitMatrix tmp = *this;
+        return maths::bits::eliminate(tmp._data.data(), tmp._max_m, tmp._max_n, tmp._stride, false);
+    }
+
+    /**
+     * Calculates the determinant over GF(2), one when the matrix is invertible
+     *
+     * @return                      Determinant of current matrix
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    bool determinant() const
+    {
+        if (!this->square())
+            throw std::logic_error("determinant can only be calculated on square matrix");
+        return this->rank() == this->_max_m;
+    }
+
+private:
+    /**
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    void _check(const size_type& m, const size_type& n) const
+    {
+        if (m >= this->_max_m || n >= this->_max_n)
+            throw std::out_of_range("position is out of range");
+    }
+
+    size_type                                                   _max_m;     // Height of the matrix
+    size_type                                                   _max_n;     // Width of the matrix
+    size_type                                                   _stride;    // Distance between rows, in words
+    std::vector<word_type, maths::AlignedAllocator<word_type>>  _data;      // Packed rows
+};
+
+/**
+ * Output stream overload for bit matrices, written as zeros and ones
+ */
+inline std::ostream& operator<<(std::ostream& out, const BitMatrix& value)
+{
+    for (size_t m = 0; m < value.height(); ++m)
+    {
+        out << (m != 0 ? ' ' : '[');
+        for (size_t n = 0; n < value.width(); ++n)
+            out << value.at(m, n) << (n < value.width() - 1 ? ", " : "");
+        out << (m < value.height() - 1 ? '\n' : ']');
+    }
+    return out;
+}
+
+#endif //BITMATRIX_HPP
@@ -0,0 +1,421 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - Expression.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [3:02 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef EXPRESSION_HPP
+#define EXPRESSION_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "simd.hpp"
+
+// Forward declarations...
+template < class K, class Alloc >
+class Matrix;
+
+template < class K, class Alloc >
+class Vector;
+
+namespace maths
+{
+namespace expr
+{
+    /**
+     * Base of every lazily evaluated element-wise expression.
+     * Nodes expose `value_type`, `result_type` (the type the expression
+     * evaluates into), `height()`, `width()` and `operator()(m, n)`.
+     * Expressions are opt-in (see maths::lazy()): they only reference their
+     * operands, so they are to be evaluated before those go out of scope
+     *
+     * @tparam E    Derived expression type
+     */
+    template < class E >
+    struct Expression
+    {
+        const E& self() const noexcept
+            { return static_cast<const E&>(*this); }
+
+        /**
+         * Evaluates the expression into a new matrix (or vector),
+         * in a single pass and without temporaries
+         *
+         * @return                      Evaluated expression
+         *
+         * @exception std::bad_alloc    Allocation failure
+         */
+        template < class T = E >
+        typename T::result_type eval() const
+            { return typename T::result_type(*this); }
+    };
+
+    /**
+     * Leaf node, referencing a concrete Matrix or Vector
+     *
+     * @tparam T    Referenced type
+     */
+    template < class T >
+    class Reference;
+
+    template < class K, class A >
+    class Reference<Matrix<K, A>>: public Expression<Reference<Matrix<K, A>>>
+    {
+    public:
+        using value_type = K;
+        using result_type = Matrix<K, A>;
+
+        explicit Reference(const Matrix<K, A>& value) noexcept:
+            _value(value) {}
+
+        size_t height() const noexcept { return this->_value.height(); }
+        size_t width() const noexcept { return this->_value.width(); }
+
+        const value_type& operator()(const size_t& m, const size_t& n) const
+            { return this->_value[{m, n}]; }
+
+        const value_type * row(const size_t& m) const noexcept
+            { return this->_value.data() + m * this->_value.stride(); }
+
+    private:
+        const Matrix<K, A>& _value; // Referenced matrix
+    };
+
+    template < class K, class A >
+    class Reference<Vector<K, A>>: public Expression<Reference<Vector<K, A>>>
+    {
+    public:
+        using value_type = K;
+        using result_type = Vector<K, A>;
+
+        explicit Reference(const Vector<K, A>& value) noexcept:
+            _value(value) {}
+
+        size_t height() const noexcept { return this->_value.height(); }
+        size_t width() const noexcept { return 1; }
+
+        const value_type& operator()(const size_t& m, const size_t&) const
+            { return this->_value[m]; }
+
+    private:
+        const Vector<K, A>& _value; // Referenced vector
+    };
+
+    /**
+     * Describes how a type takes part in expressions: concrete types are
+     * wrapped in a Reference, while expression nodes are stored by value.
+     * Left empty for types which are not operands
+     */
+    template < class T, class = void >
+    struct operand {};
+
+    template < class K, class A >
+    struct operand<Matrix<K, A>>
+    {
+        using value_type = K;
+        using result_type = Matrix<K, A>;
+        using node_type = Reference<Matrix<K, A>>;
+    };
+
+    template < class K, class A >
+    struct operand<Vector<K, A>>
+    {
+        using value_type = K;
+        using result_type = Vector<K, A>;
+        using node_type = Reference<Vector<K, A>>;
+    };
+
+    template < class T >
+    struct operand<T, typename std::enable_if<std::is_base_of<Expression<T>, T>::value>::type>
+    {
+        using value_type = typename T::value_type;
+        using result_type = typename T::result_type;
+        using node_type = T;
+    };
+
+    template < class T, class = void >
+    struct is_operand: std::false_type {};
+
+    template < class T >
+    struct is_operand<T, typename std::enable_if<
+        std::is_class<typename operand<T>::node_type>::value>::type>: std::true_type {};
+
+    // Whether two operands can be combined element-wise
+    template < class L, class R, class = void >
+    struct compatible: std::false_type {};
+
+    template < class L, class R >
+    struct compatible<L, R, typename std::enable_if<is_operand<L>::value && is_operand<R>::value>::type>:
+        std::is_same<typename operand<L>::result_type, typename operand<R>::result_type> {};
+
+    // Whether a type is an expression node, rather than a concrete operand
+    template < class T >
+    struct is_node: std::is_base_of<Expression<T>, T> {};
+
+    // Whether two operands combine lazily: at least one of them must already
+    // be an expression, as concrete ones are combined eagerly by their members
+    template < class L, class R >
+    struct combines: std::integral_constant<bool, compatible<L, R>::value
+        && (is_node<L>::value || is_node<R>::value)> {};
+
+    template < class T >
+    using node = typename operand<T>::node_type;
+
+    struct add
+    {
+        template < class X, class Y >
+        static auto apply(const X& x, const Y& y) -> decltype(x + y)
+            { return x + y; }
+    };
+
+    struct sub
+    {
+        template < class X, class Y >
+        static auto apply(const X& x, const Y& y) -> decltype(x - y)
+            { return x - y; }
+    };
+
+    /**
+     * Element-wise binary operation between two expressions of the same shape
+     *
+     * @tparam L    Left operand node
+     * @tparam R    Right operand node
+     * @tparam Op   Operation applied on each pair of elements
+     */
+    template < class L, class R, class Op >
+    class Binary: public Expression<Binary<L, R, Op>>
+    {
+    public:
+        using value_type = typename L::value_type;
+        using result_type = typename L::result_type;
+
+        /**
+         * @exception std::logic_error  Operands are of different shapes
+         */
+        Binary(const L& lhs, const R& rhs):
+            _lhs(lhs), _rhs(rhs)
+        {
+            if (lhs.height() != rhs.height() || lhs.width() != rhs.width())
+                throw std::logic_error("cannot operate with different matrix sizes");
+        }
+
+        size_t height() const noexcept { return this->_lhs.height(); }
+        size_t width() const noexcept { return this->_lhs.width(); }
+
+        value_type operator()(const size_t& m, const size_t& n) const
+            { return Op::apply(this->_lhs(m, n), this->_rhs(m, n)); }
+
+        const L& lhs() const noexcept { return this->_lhs; }
+        const R& rhs() const noexcept { return this->_rhs; }
+
+    private:
+        L   _lhs;   // Left operand
+        R   _rhs;   // Right operand
+    };
+
+    /**
+     * Multiplication of every element of an expression by a scalar
+     *
+     * @tparam E    Operand node
+     */
+    template < class E >
+    class Scaled: public Expression<Scaled<E>>
+    {
+    public:
+        using value_type = typename E::value_type;
+        using result_type = typename E::result_type;
+
+        Scaled(const E& value, const value_type& factor):
+            _value(value), _factor(factor) {}
+
+        size_t height() const noexcept { return this->_value.height(); }
+        size_t width() const noexcept { return this->_value.width(); }
+
+        value_type operator()(const size_t& m, const size_t& n) const
+            { return this->_value(m, n) * this->_factor; }
+
+    private:
+        E           _value;     // Scaled operand
+        value_type  _factor;    // Scalar factor
+    };
+
+    struct assign
+    {
+        template < class X, class Y >
+        void operator()(X& x, const Y& y) const { x = y; }
+    };
+
+    struct add_assign
+    {
+        template < class X, class Y >
+        void operator()(X& x, const Y& y) const { x += y; }
+    };
+
+    struct sub_assign
+    {
+        template < class X, class Y >
+        void operator()(X& x, const Y& y) const { x -= y; }
+    };
+
+    /**
+     * Evaluates any expression node element by element
+     */
+    template < class E, class Op >
+    void fill(const E& value, typename E::value_type* data, const size_t& stride, const Op& op)
+    {
+        const size_t height = value.height();
+        const size_t width = value.width();
+        for (size_t m = 0; m < height; ++m, data += stride)
+            for (size_t n = 0; n < width; ++n)
+                op(data[n], value(m, n));
+    }
+
+    /**
+     * Assigns the sum or difference of two matrices row by row, through
+     * the SIMD kernels. The destination may be either operand
+     */
+    template < class K, class A, class Op >
+    void fill(const Binary<Reference<Matrix<K, A>>, Reference<Matrix<K, A>>, Op>& value,
+              K* data, const size_t& stride, const assign& op)
+    {
+        const size_t height = value.height();
+        const size_t width = value.width();
+        const bool subtract = std::is_same<Op, sub>::value;
+        for (size_t m = 0; m < height; ++m, data += stride)
+        {
+            const K* left = value.lhs().row(m);
+            const K* right = value.rhs().row(m);
+            if (data == right && subtract)
+                for (size_t n = 0; n < width; ++n)
+                    op(data[n], value(m, n));
+            else if (data == right)
+                maths::simd::add(data, left, width);
+            else
+            {
+                if (data != left)
+                    std::copy(left, left + width, data);
+                if (subtract)
+                    maths::simd::sub(data, right, width);
+                else
+                    maths::simd::add(data, right, width);
+            }
+        }
+    }
+
+    /**
+     * Evaluates an expression into a destination buffer, in a single pass
+     *
+     * @param expr                  Expression to evaluate
+     * @param data                  Row-major destination, of the expression's shape
+     * @param stride                Distance between the destination's rows
+     * @param op                    Operation combining the destination and the value
+     */
+    template < class E, class Op >
+    void evaluate(const Expression<E>& expr, typename E::value_type* data, const size_t& stride, const Op& op)
+        { fill(expr.self(), data, stride, op); }
+}
+
+    /**
+     * Starts an element-wise expression over a matrix: operators applied
+     * on it (and on the resulting expressions) are then evaluated lazily,
+     * in a single pass once assigned, such as `c = lazy(a) + b * 2 - d`.
+     * Plain operators on matrices evaluate eagerly instead
+     *
+     * @param value                 Referenced matrix, to outlive the expression
+     * @return                      Expression referencing the matrix
+     */
+    template < class K, class A >
+    expr::Reference<Matrix<K, A>> lazy(const Matrix<K, A>& value) noexcept
+        { return expr::Reference<Matrix<K, A>>(value); }
+
+    /**
+     * Starts an element-wise expression over a vector (see lazy() for matrices)
+     *
+     * @param value                 Referenced vector, to outlive the expression
+     * @return                      Expression referencing the vector
+     */
+    template < class K, class A >
+    expr::Reference<Vector<K, A>> lazy(const Vector<K, A>& value) noexcept
+        { return expr::Reference<Vector<K, A>>(value); }
+}
+
+/**
+ * Lazily adds two matrices (or vectors) of the same shape,
+ * one of them at least being an expression
+ *
+ * @exception std::logic_error  Operands are of different shapes
+ */
+template < class L, class R >
+typename std::enable_if<maths::expr::combines<L, R>::value,
+    maths::expr::Binary<maths::expr::node<L>, maths::expr::node<R>, maths::expr::add>>::type
+operator+(const L& lhs, const R& rhs)
+{
+    return maths::expr::Binary<maths::expr::node<L>, maths::expr::node<R>, maths::expr::add>(
+        maths::expr::node<L>(lhs), maths::expr::node<R>(rhs));
+}
+
+/**
+ * Lazily subtracts two matrices (or vectors) of the same shape,
+ * one of them at least being an expression
+ *
+ * @exception std::logic_error  Operands are of different shapes
+ */
+template < class L, class R >
+typename std::enable_if<maths::expr::combines<L, R>::value,
+    maths::expr::Binary<maths::expr::node<L>, maths::expr::node<R>, maths::expr::sub>>::type
+operator-(const L& lhs, const R& rhs)
+{
+    return maths::expr::Binary<maths::expr::node<L>, maths::expr::node<R>, maths::expr::sub>(
+        maths::expr::node<L>(lhs), maths::expr::node<R>(rhs));
+}
+
+/**
+ * Lazily multiplies an expression by a scalar
+ */
+template < class L >
+typename std::enable_if<maths::expr::is_node<L>::value, maths::expr::Scaled<L>>::type
+operator*(const L& lhs, const typename maths::expr::operand<L>::value_type& rhs)
+    { return maths::expr::Scaled<L>(lhs, rhs); }
+
+/**
+ * Lazily multiplies a scalar by an expression
+ */
+template < class R >
+typename std::enable_if<maths::expr::is_node<R>::value, maths::expr::Scaled<R>>::type
+operator*(const typename maths::expr::operand<R>::value_type& lhs, const R& rhs)
+    { return maths::expr::Scaled<R>(rhs, lhs); }
+
+/**
+ * Compares an expression with another operand, without evaluating it
+ *
+ * @return          TRUE if both have the same shape and values, otherwise FALSE
+ */
+template < class L, class R >
+typename std::enable_if<maths::expr::is_operand<L>::value && maths::expr::is_operand<R>::value
+    && (std::is_same<maths::expr::node<L>, L>::value || std::is_same<maths::expr::node<R>, R>::value), bool>::type
+operator==(const L& lhs, const R& rhs)
+{
+    const maths::expr::node<L> left(lhs);
+    const maths::expr::node<R> right(rhs);
+    if (left.height() != right.height() || left.width() != right.width())
+        return false;
+    for (size_t m = 0; m < left.height(); ++m)
+        for (size_t n = 0; n < left.width(); ++n)
+            if (left(m, n) != right(m, n))
+                return false;
+    return true;
+}
+
+template < class L, class R >
+typename std::enable_if<maths::expr::is_operand<L>::value && maths::expr::is_operand<R>::value
+    && (std::is_same<maths::expr::node<L>, L>::value || std::is_same<maths::expr::node<R>, R>::value), bool>::type
+operator!=(const L& lhs, const R& rhs)
+    { return !(lhs == rhs); }
+
+#endif //EXPRESSION_HPP
@@ -0,0 +1,474 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - FixedMatrix.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [7:10 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef FIXEDMATRIX_HPP
+#define FIXEDMATRIX_HPP
+
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include "general.hpp"
+
+// Forward declarations...
+template < class K, size_t M, size_t N >
+class FixedMatrix;
+
+template < class K, size_t N >
+class FixedVector;
+
+#include "Matrix.hpp"
+#include "FixedVector.hpp"
+
+namespace maths
+{
+namespace fixed
+{
+    /**
+     * Determinant of a N x N fixed matrix, by cofactor expansion
+     * along the first row, unrolled at compile time
+     * (meant for the small sizes of transforms, being in O(n!))
+     */
+    template < size_t N >
+    struct determinant
+    {
+        template < class F >
+        static constexpr typename F::value_type of(const F& a)
+            { return determinant::expand(a, typename make_indices<N>::type()); }
+
+        template < class F, size_t... J >
+        static constexpr typename F::value_type expand(const F& a, indices<J...>)
+        {
+            return maths::sum((J % 2 ? -a(0, J) : a(0, J))
+                * determinant<N - 1>::of(a.template submatrix<0, J>())...);
+        }
+    };
+
+    template <>
+    struct determinant<1>
+    {
+        template < class F >
+        static constexpr typename F::value_type of(const F& a)
+            { return a(0, 0); }
+    };
+
+    template <>
+    struct determinant<2>
+    {
+        template < class F >
+        static constexpr typename F::value_type of(const F& a)
+            { return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0); }
+    };
+
+    /**
+     * Cofactor of the cell (R, C) of a N x N fixed matrix
+     */
+    template < size_t N >
+    struct cofactor
+    {
+        template < size_t R, size_t C, class F >
+        static constexpr typename F::value_type of(const F& a)
+        {
+            return (R + C) % 2 ? -determinant<N - 1>::of(a.template submatrix<R, C>())
+                               : determinant<N - 1>::of(a.template submatrix<R, C>());
+        }
+    };
+
+    template <>
+    struct cofactor<1>
+    {
+        template < size_t R, size_t C, class F >
+        static constexpr typename F::value_type of(const F&)
+            { return 1; }
+    };
+}
+}
+
+/**
+ * Represents a mathematical matrix whose dimensions are known at compile time.
+ * Values live inline (on the stack for local variables), size mismatches are
+ * compilation errors, and operations are unrolled and usable in constant
+ * expressions. Converts from and into the dynamic Matrix
+ *
+ * @tparam K    Matrix inner working type
+ * @tparam M    Height (amount of rows)
+ * @tparam N    Width (amount of columns)
+ */
+template < class K, size_t M, size_t N >
+class FixedMatrix
+{
+    static_assert(M > 0 && N > 0, "fixed matrices cannot be empty");
+
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+
+    ~FixedMatrix() = default;
+
+    /**
+     * Constructs a matrix filled with default values
+     */
+    constexpr FixedMatrix():
+        _data{} {}
+
+    /**
+     * Constructs a matrix filled with the given value
+     *
+     * @param value                 Value of every element
+     */
+    explicit constexpr FixedMatrix(const value_type& value):
+        FixedMatrix(value, typename maths::make_indices<M * N>::type()) {}
+
+    /**
+     * Constructs a matrix from all of its values, in row-major order
+     *
+     * @param values                M * N values
+     */
+    template < class... T, class = typename std::enable_if<sizeof...(T) == M * N && M * N != 1
+        && maths::all(std::is_convertible<T, K>::value...)>::type >
+    constexpr FixedMatrix(const T&... values):
+        _data{ static_cast<value_type>(values)... } {}
+
+    /**
+     * Constructs a matrix from a dynamic one of the same shape
+     *
+     * @param other                 Matrix to copy
+     *
+     * @exception std::logic_error  Matrix is of a different shape
+     */
+    template < class A >
+    explicit FixedMatrix(const Matrix<K, A>& other):
+        _data{}
+    {
+        if (other.height() != M || other.width() != N)
+            throw std::logic_error("cannot operate with different matrix sizes");
+        for (size_type i = 0; i < M * N; ++i)
+            this->_data[i] = other[{i / N, i % N}];
+    }
+
+    constexpr FixedMatrix(const FixedMatrix& other) = default;
+    FixedMatrix& operator=(const FixedMatrix& rhs) = default;
+
+    /**
+     * Converts the matrix into a dynamic one
+     *
+     * @return                      Dynamic copy of the matrix
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    operator Matrix<K, A>() const
+    {
+        Matrix<K, A> result(M, N);
+        for (size_type i = 0; i < M * N; ++i)
+            result[{i / N, i % N}] = this->_data[i];
+        return result;
+    }
+
+    /**
+     * Adds another matrix of the same shape
+     */
+    constexpr FixedMatrix operator+(const FixedMatrix& rhs) const
+        { return this->_add(rhs, typename maths::make_indices<M * N>::type()); }
+
+    /**
+     * Subtracts another matrix of the same shape
+     */
+    constexpr FixedMatrix operator-(const FixedMatrix& rhs) const
+        { return this->_sub(rhs, typename maths::make_indices<M * N>::type()); }
+
+    /**
+     * Multiplies every element by a scalar
+     */
+    constexpr FixedMatrix operator*(const value_type& rhs) const
+        { return this->_scale(rhs, typename maths::make_indices<M * N>::type()); }
+
+    /**
+     * Multiplies by a N x P matrix, into a M x P one
+     */
+    template < size_t P >
+    constexpr FixedMatrix<K, M, P> operator*(const FixedMatrix<K, N, P>& rhs) const
+        { return this->_multiply(rhs, typename maths::make_indices<M * P>::type()); }
+
+    /**
+     * Multiplies by a vector of N elements, into one of M elements
+     */
+    constexpr FixedVector<K, M> operator*(const FixedVector<K, N>& rhs) const
+        { return FixedVector<K, M>(*this * rhs._matrix); }
+
+    FixedMatrix& operator+=(const FixedMatrix& rhs)
+    {
+        for (size_type i = 0; i < M * N; ++i)
+            this->_data[i] += rhs._data[i];
+        return *this;
+    }
+
+    FixedMatrix& operator-=(const FixedMatrix& rhs)
+    {
+        for (size_type i = 0; i < M * N; ++i)
+            this->_data[i] -= rhs._data[i];
+        return *this;
+    }
+
+    FixedMatrix& operator*=(const value_type& rhs)
+    {
+        for (size_type i = 0; i < M * N; ++i)
+            this->_data[i] *= rhs;
+        return *this;
+    }
+
+    FixedMatrix& operator*=(const FixedMatrix<K, N, N>& rhs)
+        { return *this = *this * rhs; }
+
+    constexpr bool operator==(const FixedMatrix& rhs) const
+        { return this->_equal(rhs, typename maths::make_indices<M * N>::type()); }
+
+    constexpr bool operator!=(const FixedMatrix& rhs) const
+        { return !(*this == rhs); }
+
+    /**
+     * Retrieves the element at the given coordinates, with bounds checks
+     *
+     * @param m                     Height position (usually denoted `m`)
+     * @param n                     Width position (usually denoted `n`)
+     * @return                      Reference to value at given coordinates
+     *
+     * @exception std::out_of_range Given coordinates points out of the matrix
+     */
+    value_type& at(const size_type& m, const size_type& n) &
+    {
+        if (m >= M || n >= N)
+            throw std::out_of_range("position is out of range");
+        return this->_data[m * N + n];
+    }
+
+    constexpr const value_type& at(const size_type& m, const size_type& n) const &
+        { return m < M && n < N ? this->_data[m * N + n] : throw std::out_of_range("position is out of range"); }
+
+    /**
+     * Retrieves the element at the given coordinates
+     * (Caution: does not check for bounds)
+     *
+     * @param m                     Height position (usually denoted `m`)
+     * @param n                     Width position (usually denoted `n`)
+     * @return                      Reference to value at given coordinates
+     */
+    value_type& operator()(const size_type& m, const size_type& n) & noexcept
+        { return this->_data[m * N + n]; }
+
+    constexpr const value_type& operator()(const size_type& m, const size_type& n) const & noexcept
+        { return this->_data[m * N + n]; }
+
+    value_type& operator[](const shape_type& pos) & noexcept
+        { return this->_data[pos.first * N + pos.second]; }
+
+    constexpr const value_type& operator[](const shape_type& pos) const & noexcept
+        { return this->_data[pos.first * N + pos.second]; }
+
+    static constexpr shape_type shape() noexcept
+        { return { M, N }; }
+
+    static constexpr size_type height() noexcept
+        { return M; }
+
+    static constexpr size_type width() noexcept
+        { return N; }
+
+    static constexpr size_type size() noexcept
+        { return M * N; }
+
+    static constexpr bool square() noexcept
+        { return M == N; }
+
+    value_type * data() & noexcept
+        { return this->_data; }
+
+    constexpr const value_type * data() const & noexcept
+        { return this->_data; }
+
+    /**
+     * Creates a copy of the matrix and transposes it
+     *
+     * @return                      Transposed copy of the matrix
+     */
+    constexpr FixedMatrix<K, N, M> transpose() const
+        { return this->_transpose(typename maths::make_indices<M * N>::type()); }
+
+    /**
+     * Calculates the trace of a square matrix, denoted "tr(A)"
+     *
+     * @return                      Trace value of matrix
+     */
+    constexpr value_type trace() const
+    {
+        static_assert(M == N, "trace can only be calculated on square matrix");
+        return this->_trace(typename maths::make_indices<N>::type());
+    }
+
+    /**
+     * Copies the matrix without the given row and column
+     *
+     * @tparam R                    Row to remove
+     * @tparam C                    Column to remove
+     * @return                      (M - 1) x (N - 1) matrix
+     */
+    template < size_t R, size_t C >
+    constexpr FixedMatrix<K, M - 1, N - 1> submatrix() const
+        { return this->_submatrix<R, C>(typename maths::make_indices<(M - 1) * (N - 1)>::type()); }
+
+    /**
+     * Calculates the determinant of the matrix, denoted `det(A)`
+     * (expanded at compile time, in closed form up to 2x2)
+     *
+     * @return                      Determinant of given matrix
+     */
+    constexpr value_type determinant() const
+    {
+        static_assert(M == N, "determinant can only be calculated on square matrix");
+        return maths::fixed::determinant<N>::of(*this);
+    }
+
+    /**
+     * Calculates the cofactor matrix of the matrix
+     *
+     * @return                      Cofactor matrix
+     */
+    constexpr FixedMatrix cofactor() const
+    {
+        static_assert(M == N, "cofactor can only be calculated on square matrix");
+        return this->_cofactor(typename maths::make_indices<N * N>::type());
+    }
+
+    /**
+     * Calculates the adjoint of the matrix
+     *
+     * @return                      Adjoint matrix
+     */
+    constexpr FixedMatrix adjoint() const
+    {
+        static_assert(M == N, "adjoint can only be calculated on square matrix");
+        return this->_adjoint(typename maths::make_indices<N * N>::type());
+    }
+
+    /**
+     * Calculates the inverse matrix
+     *
+     * @return                       Inverse matrix
+     *
+     * @exception std::runtime_error Matrix' determinant is 0
+     */
+    constexpr FixedMatrix inverse() const
+    {
+        static_assert(M == N, "inverse can only be calculated on square matrix");
+        return this->_inverse(this->determinant(), typename maths::make_indices<N * N>::type());
+    }
+
+private:
+    template < class, size_t, size_t >
+    friend class FixedMatrix;
+
+    template < size_t... I >
+    constexpr FixedMatrix(const value_type& value, maths::indices<I...>):
+        _data{ (static_cast<void>(I), value)... } {}
+
+    template < size_t... I >
+    constexpr FixedMatrix _add(const FixedMatrix& rhs, maths::indices<I...>) const
+        { return FixedMatrix(this->_data[I] + rhs._data[I]...); }
+
+    template < size_t... I >
+    constexpr FixedMatrix _sub(const FixedMatrix& rhs, maths::indices<I...>) const
+        { return FixedMatrix(this->_data[I] - rhs._data[I]...); }
+
+    template < size_t... I >
+    constexpr FixedMatrix _scale(const value_type& rhs, maths::indices<I...>) const
+        { return FixedMatrix(this->_data[I] * rhs...); }
+
+    template < size_t... I >
+    constexpr bool _equal(const FixedMatrix& rhs, maths::indices<I...>) const
+        { return maths::all(this->_data[I] == rhs._data[I]...); }
+
+    // Dot product of the row m with the column p of rhs
+    template < size_t P, size_t... J >
+    constexpr value_type _dot(const FixedMatrix<K, N, P>& rhs, const size_type& m, const size_type& p,
+                              maths::indices<J...>) const
+        { return maths::sum(this->_data[m * N + J] * rhs._data[J * P + p]...); }
+
+    template < size_t P, size_t... I >
+    constexpr FixedMatrix<K, M, P> _multiply(const FixedMatrix<K, N, P>& rhs, maths::indices<I...>) const
+        { return FixedMatrix<K, M, P>(this->_dot(rhs, I / P, I % P, typename maths::make_indices<N>::type())...); }
+
+    template < size_t... I >
+    constexpr FixedMatrix<K, N, M> _transpose(maths::indices<I...>) const
+        { return FixedMatrix<K, N, M>(this->_data[I % M * N + I / M]...); }
+
+    template < size_t... I >
+    constexpr value_type _trace(maths::indices<I...>) const
+        { return maths::sum(this->_data[I * N + I]...); }
+
+    template < size_t R, size_t C, size_t... I >
+    constexpr FixedMatrix<K, M - 1, N - 1> _submatrix(maths::indices<I...>) const
+    {
+        return FixedMatrix<K, M - 1, N - 1>(this->_data[
+            (I / (N - 1) + (I / (N - 1) >= R)) * N + I % (N - 1) + (I % (N - 1) >= C)]...);
+    }
+
+    template < size_t... I >
+    constexpr FixedMatrix _cofactor(maths::indices<I...>) const
+        { return FixedMatrix(maths::fixed::cofactor<N>::template of<I / N, I % N>(*this)...); }
+
+    template < size_t... I >
+    constexpr FixedMatrix _adjoint(maths::indices<I...>) const
+        { return FixedMatrix(maths::fixed::cofactor<N>::template of<I % N, I / N>(*this)...); }
+
+    template < size_t... I >
+    constexpr FixedMatrix _inverse(const value_type& det, maths::indices<I...>) const
+    {
+        return det == value_type() ? throw std::runtime_error("determinant is 0")
+            : FixedMatrix(maths::fixed::cofactor<N>::template of<I % N, I / N>(*this) / det...);
+    }
+
+    value_type  _data[M * N];   // Matrix content, in row-major order
+};
+
+template < class K, size_t M, size_t N >
+constexpr FixedMatrix<K, M, N> operator*(const K& lhs, const FixedMatrix<K, M, N>& rhs)
+    { return rhs * lhs; }
+
+/**
+ * Writes the matrix internal structure on the given output stream
+ *
+ * @tparam K        Matrix inner working type
+ * @param out       Output stream to write on
+ * @param value     Matrix to write
+ * @return          Returns output stream for chaining
+ */
+template < class K, size_t M, size_t N >
+std::ostream& operator<<(std::ostream& out, const FixedMatrix<K, M, N>& value)
+{
+    for (size_t m = 0; m < M; ++m)
+    {
+        out << (m != 0 ? ' ' : '[');
+        for (size_t n = 0; n < N; ++n)
+            out << value(m, n) << (n < N - 1 ? ", " : "");
+        out << (m < M - 1 ? '\n' : ']');
+    }
+    return out;
+}
+
+using f32Matrix2 = FixedMatrix<float, 2, 2>;    // Helper type for float 2x2 Matrix
+using f32Matrix3 = FixedMatrix<float, 3, 3>;    // Helper type for float 3x3 Matrix
+using f32Matrix4 = FixedMatrix<float, 4, 4>;    // Helper type for float 4x4 Matrix
+
+using f64Matrix2 = FixedMatrix<double, 2, 2>;   // Helper type for double 2x2 Matrix
+using f64Matrix3 = FixedMatrix<double, 3, 3>;   // Helper type for double 3x3 Matrix
+using f64Matrix4 = FixedMatrix<double, 4, 4>;   // Helper type for double 4x4 Matrix
+
+#endif //FIXEDMATRIX_HPP
@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - FixedVector.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [7:35 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef FIXEDVECTOR_HPP
+#define FIXEDVECTOR_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include "general.hpp"
+
+// Forward declaration
+template < class K, size_t M, size_t N >
+class FixedMatrix;
+
+#include "FixedMatrix.hpp"
+
+/**
+ * Represents a mathematical vector whose size is known at compile time,
+ * acting as a wrapper for FixedMatrix
+ *
+ * @tparam K    Vector's inner working type
+ * @tparam N    Size of the vector
+ */
+template < class K, size_t N >
+class FixedVector
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+
+    ~FixedVector() = default;
+
+    constexpr FixedVector():
+        _matrix() {}
+
+    explicit constexpr FixedVector(const value_type& value):
+        _matrix(value) {}
+
+    template < class... T, class = typename std::enable_if<sizeof...(T) == N && N != 1
+        && maths::all(std::is_convertible<T, K>::value...)>::type >
+    constexpr FixedVector(const T&... values):
+        _matrix(values...) {}
+
+    explicit constexpr FixedVector(const FixedMatrix<K, N, 1>& other):
+        _matrix(other) {}
+
+    /**
+     * Constructs a vector from a dynamic one of the same size
+     *
+     * @exception std::logic_error  Vector is of a different size
+     */
+    template < class A >
+    explicit FixedVector(const Vector<K, A>& other):
+        _matrix()
+    {
+        if (other.size() != N)
+            throw std::logic_error("cannot operate on vectors of various sizes");
+        for (size_type i = 0; i < N; ++i)
+            this->_matrix(i, 0) = other[i];
+    }
+
+    constexpr FixedVector(const FixedVector& other) = default;
+    FixedVector& operator=(const FixedVector& rhs) = default;
+
+    /**
+     * Converts the vector into a dynamic one
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    operator Vector<K, A>() const
+        { return Vector<K, A>(static_cast<Matrix<K, A>>(this->_matrix)); }
+
+    constexpr FixedVector operator+(const FixedVector& rhs) const
+        { return FixedVector(this->_matrix + rhs._matrix); }
+
+    constexpr FixedVector operator-(const FixedVector& rhs) const
+        { return FixedVector(this->_matrix - rhs._matrix); }
+
+    constexpr FixedVector operator*(const value_type& rhs) const
+        { return FixedVector(this->_matrix * rhs); }
+
+    FixedVector& operator+=(const FixedVector& rhs)
+        { this->_matrix += rhs._matrix; return *this; }
+
+    FixedVector& operator-=(const FixedVector& rhs)
+        { this->_matrix -= rhs._matrix; return *this; }
+
+    FixedVector& operator*=(const value_type& rhs)
+        { this->_matrix *= rhs; return *this; }
+
+    constexpr bool operator==(const FixedVector& rhs) const
+        { return this->_matrix == rhs._matrix; }
+
+    constexpr bool operator!=(const FixedVector& rhs) const
+        { return this->_matrix != rhs._matrix; }
+
+    value_type& at(const size_type& m) &
+        { return this->_matrix.at(m, 0); }
+
+    constexpr const value_type& at(const size_type& m) const &
+        { return this->_matrix.at(m, 0); }
+
+    value_type& operator[](const size_type& m) & noexcept
+        { return this->_matrix(m, 0); }
+
+    constexpr const value_type& operator[](const size_type& m) const & noexcept
+        { return this->_matrix(m, 0); }
+
+    static constexpr shape_type shape() noexcept
+        { return { N, 1 }; }
+
+    static constexpr size_type height() noexcept
+        { return N; }
+
+    static constexpr size_type width() noexcept
+        { return 1; }
+
+    static constexpr size_type size() noexcept
+        { return N; }
+
+    /**
+     * Calculates the dot product with another vector (unrolled)
+     *
+     * @return                      Dot product
+     */
+    constexpr value_type dot(const FixedVector& other) const
+        { return (this->_matrix.transpose() * other._matrix)(0, 0); }
+
+    /**
+     * Converts the vector into a matrix by copy
+     *
+     * @return                      N x 1 matrix
+     */
+    constexpr FixedMatrix<K, N, 1> to_matrix() const
+        { return this->_matrix; }
+
+private:
+    template < class, size_t, size_t >
+    friend class FixedMatrix;
+
+    FixedMatrix<K, N, 1>    _matrix;    // Vector's inner matrix
+};
+
+template < class K, size_t N >
+constexpr FixedVector<K, N> operator*(const K& lhs, const FixedVector<K, N>& rhs)
+    { return rhs * lhs; }
+
+template < class K, size_t N >
+std::ostream& operator<<(std::ostream& out, const FixedVector<K, N>& value)
+    { return out << value.to_matrix(); }
+
+using f32Vector2 = FixedVector<float, 2>;       // Helper type for float 2D Vector
+using f32Vector3 = FixedVector<float, 3>;       // Helper type for float 3D Vector
+using f32Vector4 = FixedVector<float, 4>;       // Helper type for float 4D Vector
+
+using f64Vector2 = FixedVector<double, 2>;      // Helper type for double 2D Vector
+using f64Vector3 = FixedVector<double, 3>;      // Helper type for double 3D Vector
+using f64Vector4 = FixedVector<double, 4>;      // Helper type for double 4D Vector
+
+#endif //FIXEDVECTOR_HPP
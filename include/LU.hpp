@@ -0,0 +1,557 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - LU.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [4:40 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef LU_HPP
+#define LU_HPP
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include "general.hpp"
+#include "gemm.hpp"
+#include "Arena.hpp"
+#include "Matrix.hpp"
+
+/**
+ * LU factorization with partial pivoting, denoted `PA = LU`, of a square matrix.
+ * Factors are stored packed within a single matrix: L below the diagonal
+ * (with an implicit unit diagonal) and U on and above it
+ *
+ * @tparam K        Matrix inner working type
+ * @tparam Alloc    Allocator of the factors and pivots
+ */
+template < class K, class Alloc >
+class LU
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using allocator_type = Alloc;
+    using pivots_type = std::vector<size_type,
+        typename std::allocator_traits<Alloc>::template rebind_alloc<size_type>>;
+
+    // Width of the panels factorized before updating the trailing matrix
+    static constexpr size_type BLOCK = 64;
+
+    LU() = delete;
+    ~LU() = default;
+
+    /**
+     * Factorizes the given matrix. Singular matrices are still factorized,
+     * but leave a negligible value on the diagonal of U
+     *
+     * @param matrix                Square matrix to factorize
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit LU(const Matrix<K, Alloc>& matrix):
+        _factors(matrix), _pivots(matrix.height()), _swaps(0), _singular(false), _deficient(false),
+        _tolerance()
+    {
+        if (!matrix.square())
+            throw std::logic_error("LU factorization can only be calculated on square matrix");
+        this->_factorize();
+    }
+
+    /**
+     * Factorizes the given matrix, converting its values into K
+     * (e.g. for working in a wider type)
+     *
+     * @param matrix                Square matrix to factorize
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class T, class A >
+    explicit LU(const Matrix<T, A>& matrix):
+        _factors(matrix.height(), matrix.width()), _pivots(matrix.height()), _swaps(0), _singular(false),
+        _deficient(false), _tolerance()
+    {
+        if (!matrix.square())
+            throw std::logic_error("LU factorization can only be calculated on square matrix");
+        for (size_type m = 0; m < matrix.height(); ++m)
+            for (size_type n = 0; n < matrix.width(); ++n)
+                this->_factors[{m, n}] = static_cast<K>(matrix[{m, n}]);
+        this->_factorize();
+    }
+
+    /**
+     * Retrieves the packed factors, L strictly below the diagonal and U above
+     *
+     * @return                      Packed factors
+     */
+    const Matrix<K, Alloc>& factors() const noexcept
+        { return this->_factors; }
+
+    /**
+     * Retrieves the row interchanges: row `i` was swapped with row `pivots()[i]`,
+     * in increasing order of `i`
+     *
+     * @return                      Pivot indices
+     */
+    const pivots_type& pivots() const noexcept
+        { return this->_pivots; }
+
+    /**
+     * Retrieves the size of the factorized matrix
+     *
+     * @return                      Matrix height (and width)
+     */
+    size_type size() const noexcept
+        { return this->_factors.height(); }
+
+    /**
+     * Checks if the factorized matrix is numerically singular, having a pivot
+     * negligible before the rounding errors of the factorization
+     * (`n * epsilon * max(|A|)`). Only a query: the determinant, inverse and
+     * solutions are still calculated for such matrices
+     *
+     * @return                      TRUE if singular, otherwise FALSE
+     */
+    bool singular() const noexcept
+        { return this->_singular; }
+
+    /**
+     * Checks if the inverse and solutions can be calculated: no pivot vanishes
+     * before the rounding errors of its own row (`n * epsilon * max(|A(i, :)|)`
+     * for the row `i` it came from), so that rows of any scale are kept
+     *
+     * @return                      TRUE if invertible, otherwise FALSE
+     */
+    bool invertible() const noexcept
+        { return !this->_deficient; }
+
+    /**
+     * Calculates the determinant of the factorized matrix, denoted `det(A)`,
+     * as the signed product of U's diagonal, whatever the scale of the matrix.
+     * It is 0 when the matrix is not invertible (see invertible()): a pivot
+     * negligible before its own row is rounding noise left by the elimination
+     *
+     * @return                      Determinant of the factorized matrix
+     */
+    value_type determinant() const
+    {
+        if (this->_deficient)
+            return value_type();
+        value_type result = this->_swaps % 2 ? -1 : 1;
+        for (size_type i = 0; i < this->size(); ++i)
+            result *= this->_factors[{i, i}];
+        return result;
+    }
+
+    /**
+     * Calculates the inverse of the factorized matrix, denoted `inverse(A)`,
+     * as `inverse(U) * inverse(L) * P`, into a copy of the factors
+     *
+     * @return                      Inverse matrix
+     *
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K, Alloc> inverse() const &
+    {
+        Matrix<K, Alloc> result = this->_factors;
+        this->_invert(result);
+        return result;
+    }
+
+    /**
+     * Calculates the inverse of the factorized matrix, overwriting
+     * the factors, which avoids allocating the result
+     *
+     * @return                      Inverse matrix
+     *
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K, Alloc> inverse() &&
+    {
+        this->_invert(this->_factors);
+        return std::move(this->_factors);
+    }
+
+    /**
+     * Solves the system `AX = B` for every column of B at once
+     *
+     * @param rhs                   Right-hand sides, one per column
+     * @return                      Solutions, one per column
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    Matrix<K, A> solve(const Matrix<K, A>& rhs) const
+    {
+        Matrix<K, A> result = rhs;
+        this->solve_inplace(result);
+        return result;
+    }
+
+    /**
+     * Solves the system `Ax = b`
+     *
+     * @param rhs                   Right-hand side
+     * @return                      Solution
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    Vector<K, A> solve(const Vector<K, A>& rhs) const
+    {
+        Vector<K, A> result = rhs;
+        this->solve_inplace(result);
+        return result;
+    }
+
+    /**
+     * Solves the system `AX = B` for every column of B at once,
+     * overwriting B with the solutions
+     *
+     * @param rhs                   Right-hand sides, one per column
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    void solve_inplace(Matrix<K, A>& rhs) const
+    {
+        if (rhs.height() != this->size())
+            throw std::logic_error("cannot solve with different matrix heights");
+        if (!rhs.empty())
+            this->_substitute(rhs.data(), rhs.width(), rhs.stride());
+    }
+
+    /**
+     * Solves the system `Ax = b`, overwriting b with the solution
+     *
+     * @param rhs                   Right-hand side
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    void solve_inplace(Vector<K, A>& rhs) const
+        { this->solve_inplace(rhs.view()); }
+
+    /**
+     * Solves the system `AX = B` in place of a view, such as a block
+     * of a larger matrix, without copying it
+     *
+     * @param rhs                   Right-hand sides, one per column
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    void solve_inplace(const MatrixView<K>& rhs) const
+    {
+        if (rhs.height() != this->size())
+            throw std::logic_error("cannot solve with different matrix heights");
+        if (!rhs.empty())
+            this->_substitute(rhs.data(), rhs.width(), rhs.stride());
+    }
+
+    /**
+     * Solves the system `Ax = b` in place of a view, such as a column
+     * of a matrix, without copying it
+     *
+     * @param rhs                   Right-hand side
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is not invertible (see invertible())
+     * @exception std::bad_alloc    Allocation failure
+     */
+    void solve_inplace(const VectorView<K>& rhs) const
+    {
+        if (rhs.height() != this->size())
+            throw std::logic_error("cannot solve with different matrix heights");
+        if (!rhs.empty())
+            this->_substitute(rhs.data(), 1, rhs.step());
+    }
+
+private:
+    /**
+     * Magnitude used for choosing pivots
+     */
+    static value_type _magnitude(const value_type& value)
+        { return value < value_type() ? -value : value; }
+
+    /**
+     * Blocked right-looking factorization: each panel is factorized in place,
+     * then the row block of U is solved and the trailing matrix updated
+     * through the GEMM engine
+     */
+    void _factorize()
+    {
+        const size_type n = this->size();
+        if (!n)
+            return;
+        value_type * a = &this->_factors[{0, 0}];
+        const size_type lda = this->_factors.stride();
+
+        value_type largest = value_type();
+        for (size_type i = 0; i < n; ++i)
+            for (size_type j = 0; j < n; ++j)
+                if (largest < _magnitude(a[i * lda + j]))
+                    largest = _magnitude(a[i * lda + j]);
+        this->_tolerance = std::numeric_limits<value_type>::epsilon() * static_cast<value_type>(n) * largest;
+
+        // Scale of each row, following it through the interchanges
+        maths::Scratch<value_type> scale(n);
+        for (size_type i = 0; i < n; ++i)
+        {
+            scale[i] = value_type();
+            for (size_type j = 0; j < n; ++j)
+                if (scale[i] < _magnitude(a[i * lda + j]))
+                    scale[i] = _magnitude(a[i * lda + j]);
+        }
+
+        for (size_type k = 0; k < n; k += BLOCK)
+        {
+            const size_type nb = n - k < BLOCK ? n - k : BLOCK;
+            this->_factorize_panel(a, n, lda, k, nb, scale.get());
+
+            const size_type rest = n - k - nb;
+            if (!rest)
+                break;
+
+            // U12 = inverse(L11) * A12
+            for (size_type i = k + 1; i < k + nb; ++i)
+                for (size_type p = k; p < i; ++p)
+                {
+                    const value_type factor = a[i * lda + p];
+                    for (size_type j = k + nb; j < n; ++j)
+                        a[i * lda + j] -= factor * a[p * lda + j];
+                }
+
+            // A22 -= L21 * U12
+            maths::Scratch<value_type> lower(rest * nb);
+            for (size_type i = 0; i < rest; ++i)
+                for (size_type p = 0; p < nb; ++p)
+                    lower[i * nb + p] = -a[(k + nb + i) * lda + k + p];
+            maths::gemm::multiply(rest, rest, nb,
+                                  lower.get(), nb,
+                                  a + k * lda + k + nb, lda,
+                                  a + (k + nb) * lda + k + nb, lda);
+        }
+    }
+
+    /**
+     * Factorizes the columns [k, k + nb) below the diagonal, swapping whole rows
+     * along with their scales
+     */
+    void _factorize_panel(value_type * a, const size_type& n, const size_type& lda,
+                          const size_type& k, const size_type& nb, value_type * scale)
+    {
+        const value_type epsilon = std::numeric_limits<value_type>::epsilon() * static_cast<value_type>(n);
+        for (size_type j = k; j < k + nb; ++j)
+        {
+            size_type pivot = j;
+            value_type best = _magnitude(a[j * lda + j]);
+            for (size_type i = j + 1; i < n; ++i)
+                if (best < _magnitude(a[i * lda + j]))
+                {
+                    best = _magnitude(a[i * lda + j]);
+                    pivot = i;
+                }
+
+            this->_pivots[j] = pivot;
+            if (pivot != j)
+            {
+                this->_factors.swap_rows(j, pivot);
+                std::swap(scale[j], scale[pivot]);
+                ++this->_swaps;
+            }
+
+            const value_type diagonal = a[j * lda + j];
+            if (!(this->_tolerance < best))
+                this->_singular = true;
+            if (!(epsilon * scale[j] < best))
+                this->_deficient = true;
+            if (diagonal == value_type())
+                continue;
+            for (size_type i = j + 1; i < n; ++i)
+            {
+                const value_type factor = a[i * lda + j] /= diagonal;
+                for (size_type c = j + 1; c < k + nb; ++c)
+                    a[i * lda + c] -= factor * a[j * lda + c];
+            }
+        }
+    }
+
+    /**
+     * Overwrites the packed factors with the inverse: U is inverted in place,
+     * then `inverse(A) * L = inverse(U)` is solved from the last column on,
+     * with panels updated through the GEMM engine, and finally the row
+     * interchanges are applied on columns in reverse order
+     */
+    void _invert(Matrix<K, Alloc>& target) const
+    {
+        if (this->_deficient)
+            throw std::runtime_error("determinant is 0");
+        const size_type n = this->size();
+        if (!n)
+            return;
+        value_type * a = &target[{0, 0}];
+        const size_type lda = target.stride();
+        maths::Scratch<value_type> work(n * (n < BLOCK ? n : BLOCK));
+
+        // inverse(U), from the last row on, each one only needing the ones below
+        for (size_type i = n; i--;)
+        {
+            value_type * row = a + i * lda;
+            const value_type diagonal = value_type(1) / row[i];
+            for (size_type j = i + 1; j < n; ++j)
+                work[j] = value_type();
+            for (size_type p = i + 1; p < n; ++p)
+            {
+                const value_type factor = row[p];
+                const value_type * below = a + p * lda;
+                for (size_type j = p; j < n; ++j)
+                    work[j] += factor * below[j];
+            }
+            row[i] = diagonal;
+            for (size_type j = i + 1; j < n; ++j)
+                row[j] = -diagonal * work[j];
+        }
+
+        // inverse(A) * L = inverse(U), by panels of columns from the right
+        size_type end = n;
+        while (end)
+        {
+            const size_type nb = end < BLOCK ? end : BLOCK;
+            const size_type start = end - nb;
+
+            // Moves the panel's part of L out, into a negated workspace
+            for (size_type i = start + 1; i < n; ++i)
+                for (size_type j = start; j < end && j < i; ++j)
+                {
+                    work[(i - start) * nb + j - start] = -a[i * lda + j];
+                    a[i * lda + j] = value_type();
+                }
+
+            // Columns on the right of the panel are final already
+            if (end < n)
+                maths::gemm::multiply(n, nb, n - end,
+                                      a + end, lda,
+                                      work.get() + (end - start) * nb, nb,
+                                      a + start, lda);
+
+            for (size_type j = end; j-- > start;)
+                for (size_type r = 0; r < n; ++r)
+                {
+                    value_type * row = a + r * lda;
+                    value_type sum = value_type();
+                    for (size_type i = j + 1; i < end; ++i)
+                        sum += row[i] * work[(i - start) * nb + j - start];
+                    row[j] += sum;
+                }
+            end = start;
+        }
+
+        for (size_type j = n - 1; j--;)
+            if (this->_pivots[j] != j)
+                target.swap_columns(j, this->_pivots[j]);
+    }
+
+    /**
+     * Applies `inverse(U) * inverse(L) * P` on a row-major block of right-hand
+     * sides: rows are permuted, then both substitutions run by blocks of rows,
+     * each one first updated through the GEMM engine with the rows already
+     * solved, then solved within itself row by row
+     *
+     * @param b                     Right-hand sides, of `size()` rows
+     * @param width                 Amount of right-hand sides
+     * @param ldb                   Distance between two rows of `b`
+     */
+    void _substitute(value_type * b, const size_type& width, const size_type& ldb) const
+    {
+        if (this->_deficient)
+            throw std::runtime_error("cannot solve a singular system");
+        const size_type n = this->size();
+        const value_type * a = &this->_factors[{0, 0}];
+        const size_type lda = this->_factors.stride();
+        maths::Scratch<value_type> work(n * (n < BLOCK ? n : BLOCK));
+
+        for (size_type i = 0; i < n; ++i)
+            if (this->_pivots[i] != i)
+                std::swap_ranges(b + i * ldb, b + i * ldb + width, b + this->_pivots[i] * ldb);
+
+        // Ly = Pb, from the top
+        for (size_type k = 0; k < n; k += BLOCK)
+        {
+            const size_type nb = n - k < BLOCK ? n - k : BLOCK;
+            if (k)
+            {
+                for (size_type i = 0; i < nb; ++i)
+                    for (size_type p = 0; p < k; ++p)
+                        work[i * k + p] = -a[(k + i) * lda + p];
+                maths::gemm::multiply(nb, width, k, work.get(), k, b, ldb, b + k * ldb, ldb);
+            }
+            for (size_type i = k + 1; i < k + nb; ++i)
+                for (size_type p = k; p < i; ++p)
+                    _axpy(width, -a[i * lda + p], b + p * ldb, b + i * ldb);
+        }
+
+        // Ux = y, from the bottom
+        for (size_type end = n, start; end; end = start)
+        {
+            const size_type nb = end < BLOCK ? end : BLOCK;
+            start = end - nb;
+            const size_type rest = n - end;
+            if (rest)
+            {
+                for (size_type i = 0; i < nb; ++i)
+                    for (size_type p = 0; p < rest; ++p)
+                        work[i * rest + p] = -a[(start + i) * lda + end + p];
+                maths::gemm::multiply(nb, width, rest, work.get(), rest, b + end * ldb, ldb,
+                                      b + start * ldb, ldb);
+            }
+            for (size_type i = end; i-- > start;)
+            {
+                value_type * row = b + i * ldb;
+                for (size_type p = i + 1; p < end; ++p)
+                    _axpy(width, -a[i * lda + p], b + p * ldb, row);
+                const value_type diagonal = a[i * lda + i];
+                for (size_type c = 0; c < width; ++c)
+                    row[c] /= diagonal;
+            }
+        }
+    }
+
+    /**
+     * Adds `factor * x` to y, over the given amount of elements
+     */
+    static void _axpy(const size_type& count, const value_type& factor, const value_type * x, value_type * y)
+    {
+        if (factor == value_type())
+            return;
+        for (size_type c = 0; c < count; ++c)
+            y[c] += factor * x[c];
+    }
+
+    Matrix<K, Alloc>        _factors;   // Packed L and U factors
+    pivots_type             _pivots;    // Row interchanges
+    size_type               _swaps;     // Amount of effective row interchanges
+    bool                    _singular;  // Whether a pivot is negligible
+    bool                    _deficient; // Whether a pivot is negligible before its own row
+    value_type              _tolerance; // Magnitude under which pivots are negligible
+};
+
+#endif //LU_HPP
@@ -13,32 +13,59 @@
 #define MATRIX_HPP
 
 #include <cmath>
+#include <memory>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
 #include <iostream>
 #include "general.hpp"
+#include "AlignedAllocator.hpp"
+#include "Arena.hpp"
+#include "simd.hpp"
+#include "gemm.hpp"
+#include "strassen.hpp"
+#include "transpose.hpp"
+#include "bareiss.hpp"
+#include "exact.hpp"
+#include "Expression.hpp"
 
 // Forward declaration...
-template < class K >
+template < class K, class Alloc >
 class Vector;
 
 #include "Vector.hpp"
 
+template < class K, class Alloc = maths::AlignedAllocator<K> >
+class LU;
+
+template < class K, class Alloc = maths::AlignedAllocator<K> >
+class QR;
+
+template < class K >
+class MatrixView;
+
+template < class K >
+class VectorView;
+
 /**
  * Represents a mathematical matrix, with various utilities functions
  * and overloads to simplify its usage and calculus
  *
- * @tparam K    Matrix inner working type
+ * @tparam K        Matrix inner working type
+ * @tparam Alloc    Allocator of the values (64-byte aligned by default),
+ *                  which may also request rows to be padded (see maths::row_padding)
  */
-template < class K >
+template < class K, class Alloc = maths::AlignedAllocator<K> >
 class Matrix
 {
 public:
     using value_type = K;
     using size_type = size_t;
     using shape_type = std::pair<size_type, size_type>;
+    using allocator_type = Alloc;
 
     Matrix() = delete;
-    ~Matrix() { delete[] this->_data; }
+    ~Matrix() { this->_release(); }
 
     /**
      * Constructs a new matrix of given size and value
@@ -46,15 +73,16 @@ public:
      * @param height                Height of the matrix (usually denoted `m`)
      * @param width                 Width of the matrix (usually denoted `n`)
      * @param value                 Default value to fill the matrix with
+     * @param allocator             Allocator to use for the values
      *
      * @exception std::bad_alloc    Allocation failure
      */
-    Matrix(const size_type& height, const size_type& width, const value_type& value = value_type()):
-        _max_m(height), _max_n(width), _data(new value_type[height * width])
-    {
-        for (size_type i = 0; i < this->size(); ++i)
-            this->_data[i] = value;
-    }
+    Matrix(const size_type& height, const size_type& width, const value_type& value = value_type(),
+           const allocator_type& allocator = allocator_type()):
+        _max_m(height), _max_n(width), _stride(Matrix::_stride_of(height, width)), _allocator(allocator),
+        _data(this->_create([&value](const size_type&) -> const value_type& { return value; })),
+        _owner(), _external(false)
+        {}
 
     /**
      * Constructs a new matrix of given size and values
@@ -67,12 +95,26 @@ public:
      * @exception std::bad_alloc    Allocation failure
      */
     Matrix(const size_type& height, const size_type& width, const std::vector<value_type>& data):
-        _max_m(height), _max_n(width), _data(new value_type[_max_m * _max_n])
+        Matrix(height, width)
     {
         for (size_type i = 0; i < this->size(); ++i)
-            this->_data[i] = data.at(i);
+            (*this)[{i / width, i % width}] = data.at(i);
     }
 
+    /**
+     * Constructs a new matrix of given size, adopting the storage of the
+     * given row-major array instead of copying it
+     *
+     * @param height                Height of the matrix (usually denoted `m`)
+     * @param width                 Width of the matrix (usually denoted `n`)
+     * @param data                  Array of values to adopt
+     *
+     * @exception std::out_of_range Given array is missing values
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix(const size_type& height, const size_type& width, std::vector<value_type>&& data):
+        Matrix(Matrix::_adopt(height, width, std::move(data))) {}
+
     /**
      * Constructs a new matrix of given values
      *
@@ -82,9 +124,7 @@ public:
      * @exception std::bad_alloc    Allocation failure
      */
     explicit Matrix(const std::vector<std::vector<K>>& data):
-        _max_m(data.size()),
-        _max_n(data.empty() ? 0 : data[0].size()),
-        _data(new value_type[_max_m * (data.empty() ? 0 : data[0].size())])
+        Matrix(data.size(), data.empty() ? 0 : data[0].size())
     {
         for (size_type m = 0; m < data.size(); ++m)
             for (size_type n = 0; n < data[m].size(); ++n)
@@ -99,11 +139,10 @@ public:
      * @exception std::bad_alloc    Allocation failure
      */
     Matrix(const Matrix& other):
-        _max_m(other._max_m), _max_n(other._max_n), _data(new value_type[_max_m * _max_n])
-    {
-        for (size_type i = 0; i < this->size(); ++i)
-            this->_data[i] = other._data[i];
-    }
+        _max_m(other._max_m), _max_n(other._max_n), _stride(Matrix::_stride_of(other._max_m, other._max_n)),
+        _allocator(traits::select_on_container_copy_construction(other._allocator)),
+        _data(Matrix::_create(this->_allocator, other, this->_stride)), _owner(), _external(false)
+        {}
 
     /**
      * Move semantic implementation for Matrix
@@ -111,8 +150,63 @@ public:
      * @param other                 Matrix to move
      */
     Matrix(Matrix&& other) noexcept:
-        _max_m(other._max_m), _max_n(other._max_n), _data(std::move(other._data))
-        { other._data = nullptr; }
+        _max_m(other._max_m), _max_n(other._max_n), _stride(other._stride),
+        _allocator(std::move(other._allocator)), _data(other._data), _owner(std::move(other._owner)),
+        _external(other._external)
+    {
+        other._data = nullptr;
+        other._max_m = 0;
+        other._external = false;
+    }
+
+    /**
+     * Creates a matrix over caller-owned row-major storage, without copying it.
+     * The storage is never freed by the matrix, and must outlive it
+     *
+     * @param data                  First element
+     * @param height                Height of the matrix (usually denoted `m`)
+     * @param width                 Width of the matrix (usually denoted `n`)
+     * @param stride                Distance between two rows (the width when 0)
+     * @return                      Matrix borrowing the storage
+     *
+     * @exception std::logic_error  Stride is lower than the width
+     */
+    static Matrix borrow(value_type * data, const size_type& height, const size_type& width,
+                         const size_type& stride = 0)
+        { return Matrix(data, height, width, stride, std::shared_ptr<void>()); }
+
+    /**
+     * Creates a matrix taking ownership of row-major storage, without copying it.
+     * The deleter is called on the storage once the matrix releases it
+     *
+     * @param data                  First element
+     * @param height                Height of the matrix (usually denoted `m`)
+     * @param width                 Width of the matrix (usually denoted `n`)
+     * @param stride                Distance between two rows (the width when 0)
+     * @param deleter               Callable releasing the storage
+     * @return                      Matrix owning the storage
+     *
+     * @exception std::logic_error  Stride is lower than the width
+     * @exception std::bad_alloc    Allocation failure (the deleter is then called)
+     */
+    template < class D >
+    static Matrix adopt(value_type * data, const size_type& height, const size_type& width,
+                        const size_type& stride, D deleter)
+        { return Matrix(data, height, width, stride, std::shared_ptr<void>(data, std::move(deleter))); }
+
+    /**
+     * Constructs a new matrix by evaluating an element-wise expression,
+     * in a single pass and without temporaries
+     *
+     * @param expr                  Expression to evaluate
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Matrix>::value>::type >
+    Matrix(const maths::expr::Expression<E>& expr):
+        Matrix(expr.self().height(), expr.self().width())
+        { maths::expr::evaluate(expr, this->_data, this->_stride, maths::expr::assign()); }
 
     /**
      * Constructs a new matrix by copying an existing vector
@@ -120,8 +214,8 @@ public:
      * @param other                 Vector to copy
      */
     template <typename = typename
-        std::enable_if<std::is_same<Vector<value_type>, Vector<value_type>>::value>::type>
-    explicit Matrix(const Vector<value_type>& other):
+        std::enable_if<std::is_same<Vector<value_type, Alloc>, Vector<value_type, Alloc>>::value>::type>
+    explicit Matrix(const Vector<value_type, Alloc>& other):
         Matrix(other._matrix) {}
 
     /**
@@ -130,8 +224,8 @@ public:
      * @param other                 Vector to move
      */
     template <typename = typename
-        std::enable_if<std::is_same<Vector<value_type>, Vector<value_type>>::value>::type>
-    explicit Matrix(Vector<value_type>&& other) noexcept:
+        std::enable_if<std::is_same<Vector<value_type, Alloc>, Vector<value_type, Alloc>>::value>::type>
+    explicit Matrix(Vector<value_type, Alloc>&& other) noexcept:
         Matrix(std::move(other._matrix)) {}
 
     /**
@@ -146,14 +240,24 @@ public:
     {
         if (this == &rhs)
             return *this;
-        delete[] this->_data;
-
-        this->_data = new value_type[rhs._max_m * rhs._max_n];
-        for (size_type i = 0; i < rhs.size(); ++i)
-            this->_data[i] = rhs._data[i];
+        if (this->shape() == rhs.shape())
+        {
+            if (this->_flat(rhs))
+                std::copy(rhs._data, rhs._data + rhs._capacity(), this->_data);
+            else
+                for (size_type m = 0; m < this->_max_m; ++m)
+                    std::copy(rhs._data + m * rhs._stride, rhs._data + m * rhs._stride + rhs._max_n,
+                              this->_data + m * this->_stride);
+            return *this;
+        }
 
+        const size_type stride = Matrix::_stride_of(rhs._max_m, rhs._max_n);
+        value_type * data = Matrix::_create(this->_allocator, rhs, stride);
+        this->_release();
+        this->_data = data;
         this->_max_m = rhs._max_m;
         this->_max_n = rhs._max_n;
+        this->_stride = stride;
         return *this;
     }
 
@@ -167,12 +271,40 @@ public:
     {
         if (this == &rhs)
             return *this;
-        delete[] this->_data;
-
-        this->_data = std::move(rhs._data);
+        // Storage of allocators which neither propagate nor compare equal cannot be taken over
+        if (!rhs._external && !traits::propagate_on_container_move_assignment::value
+            && this->_allocator != rhs._allocator)
+            return *this = static_cast<const Matrix&>(rhs);
+        this->_release();
+
+        if (traits::propagate_on_container_move_assignment::value)
+            this->_allocator = std::move(rhs._allocator);
+        this->_data = rhs._data;
         this->_max_m = rhs._max_m;
         this->_max_n = rhs._max_n;
+        this->_stride = rhs._stride;
+        this->_owner = std::move(rhs._owner);
+        this->_external = rhs._external;
         rhs._data = nullptr;
+        rhs._max_m = 0;
+        rhs._external = false;
+        return *this;
+    }
+
+    /**
+     * Evaluates an element-wise expression into this matrix,
+     * reusing its buffer when the shape matches
+     *
+     * @param rhs                   Expression to evaluate
+     * @return                      This matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Matrix>::value>::type >
+    Matrix& operator=(const maths::expr::Expression<E>& rhs)
+    {
+        this->_assign(rhs.self());
         return *this;
     }
 
@@ -188,8 +320,11 @@ public:
     Matrix& operator+=(const Matrix& rhs)
     {
         this->check_sizes(rhs);
-        for (size_type i = 0; i < this->size(); ++i)
-            this->_data[i] += rhs._data[i];
+        if (this->_flat(rhs))
+            maths::simd::add(this->_data, rhs._data, this->_capacity());
+        else
+            for (size_type m = 0; m < this->_max_m; ++m)
+                maths::simd::add(this->_data + m * this->_stride, rhs._data + m * rhs._stride, this->_max_n);
         return *this;
     }
 
@@ -205,8 +340,45 @@ public:
     Matrix& operator-=(const Matrix& rhs)
     {
         this->check_sizes(rhs);
-        for (size_type i = 0; i < this->size(); ++i)
-            this->_data[i] -= rhs._data[i];
+        if (this->_flat(rhs))
+            maths::simd::sub(this->_data, rhs._data, this->_capacity());
+        else
+            for (size_type m = 0; m < this->_max_m; ++m)
+                maths::simd::sub(this->_data + m * this->_stride, rhs._data + m * rhs._stride, this->_max_n);
+        return *this;
+    }
+
+    /**
+     * Adds an element-wise expression to the current matrix, in a single pass
+     *
+     * @param rhs                   Expression to add
+     * @return                      This matrix
+     *
+     * @exception std::logic_error  Given expression is of different shape
+     */
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Matrix>::value>::type >
+    Matrix& operator+=(const maths::expr::Expression<E>& rhs)
+    {
+        this->_check_shape(rhs.self());
+        maths::expr::evaluate(rhs, this->_data, this->_stride, maths::expr::add_assign());
+        return *this;
+    }
+
+    /**
+     * Subtracts an element-wise expression from the current matrix, in a single pass
+     *
+     * @param rhs                   Expression to subtract
+     * @return                      This matrix
+     *
+     * @exception std::logic_error  Given expression is of different shape
+     */
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Matrix>::value>::type >
+    Matrix& operator-=(const maths::expr::Expression<E>& rhs)
+    {
+        this->_check_shape(rhs.self());
+        maths::expr::evaluate(rhs, this->_data, this->_stride, maths::expr::sub_assign());
         return *this;
     }
 
@@ -219,8 +391,11 @@ public:
      */
     Matrix& operator*=(const value_type& rhs) noexcept
     {
-        for (size_type i = 0; i < this->size(); ++i)
-            this->_data[i] *= rhs;
+        if (this->_flat(*this))
+            maths::simd::scale(this->_data, rhs, this->_capacity());
+        else
+            for (size_type m = 0; m < this->_max_m; ++m)
+                maths::simd::scale(this->_data + m * this->_stride, rhs, this->_max_n);
         return *this;
     }
 
@@ -238,17 +413,7 @@ public:
         if (this->_max_n != rhs._max_m)
             throw std::logic_error("incompatible for multiplication");
 
-        Matrix result(this->_max_m, rhs._max_n);
-        for (size_type m = 0; m < this->_max_m; ++m)
-            for (size_type n = 0; n < rhs._max_n; ++n)
-            {
-                value_type tmp = value_type();
-                for (size_type p = 0; p < this->_max_n; ++p)
-                    tmp = maths::fma((*this)[{m, p}], rhs[{p, n}], tmp);
-                result[{m, n}] = tmp;
-            }
-
-        *this = std::move(result);
+        *this = *this * rhs;
         return *this;
     }
 
@@ -261,12 +426,12 @@ public:
      *
      * @exception std::logic_error  Given vector doesn't match requirements
      */
-    Matrix& operator*=(const Vector<value_type>& rhs)
+    Matrix& operator*=(const Vector<value_type, Alloc>& rhs)
     {
         if (this->_max_n != rhs.size())
             throw std::logic_error("incompatible for multiplication");
 
-        Matrix result(this->_max_n, 1);
+        Matrix result(this->_max_m, 1);
         for (size_type m = 0; m < this->_max_m; ++m)
             for (size_type n = 0; n < this->_max_n; ++n)
                 result[{m, 0}] = maths::fma((*this)[{m, n}], rhs[n], result[{m, 0}]);
@@ -276,7 +441,7 @@ public:
 
     /**
      * Calculates the addition of 2 matrix and returns a new matrix
-     * containing the result
+     * containing the result (see maths::lazy() for fusing longer expressions)
      *
      * @param rhs                   Matrix to add
      * @return                      New matrix containing result
@@ -292,7 +457,7 @@ public:
 
     /**
      * Calculates the subtraction of 2 matrix and returns a new matrix
-     * containing the result
+     * containing the result (see maths::lazy() for fusing longer expressions)
      *
      * @param rhs                   Matrix to subtract
      * @return                      New matrix containing result
@@ -312,8 +477,10 @@ public:
      *
      * @param rhs                   Scalar value
      * @return                      New matrix containing result
+     *
+     * @exception std::bad_alloc    Allocation failure
      */
-    Matrix operator*(const value_type& rhs) const noexcept
+    Matrix operator*(const value_type& rhs) const
     {
         Matrix tmp = *this;
         tmp *= rhs;
@@ -322,7 +489,9 @@ public:
 
     /**
      * Calculates the multiplication of 2 matrix and returns a new matrix
-     * containing the result
+     * containing the result. Large products of fields run Strassen-Winograd
+     * once enabled (see maths::strassen::set_crossover), at the cost of
+     * a weaker error bound
      *
      * @param rhs                   Matrix to multiplicative
      * @return                      New matrix containing result
@@ -331,9 +500,21 @@ public:
      */
     Matrix operator*(const Matrix& rhs) const
     {
-        Matrix tmp = *this;
-        tmp *= rhs;
-        return tmp;
+        if (this->_max_n != rhs._max_m)
+            throw std::logic_error("incompatible for multiplication");
+
+        Matrix result(this->_max_m, rhs._max_n);
+        if (maths::strassen::applies<value_type>(this->_max_m, rhs._max_n, this->_max_n))
+            maths::strassen::multiply(this->_max_m, rhs._max_n, this->_max_n,
+                                      this->_data, this->_stride,
+                                      rhs._data, rhs._stride,
+                                      result._data, result._stride);
+        else
+            maths::gemm::multiply(this->_max_m, rhs._max_n, this->_max_n,
+                                  this->_data, this->_stride,
+                                  rhs._data, rhs._stride,
+                                  result._data, result._stride);
+        return result;
     }
 
     /**
@@ -345,11 +526,11 @@ public:
      *
      * @exception std::logic_error  Given vector doesn't match requirements
      */
-    Vector<value_type> operator*(const Vector<value_type>& rhs) const
+    Vector<value_type, Alloc> operator*(const Vector<value_type, Alloc>& rhs) const
     {
         Matrix tmp = *this;
         tmp *= rhs;
-        return Vector<value_type>(std::move(tmp));
+        return Vector<value_type, Alloc>(std::move(tmp));
     }
 
     /**
@@ -363,10 +544,9 @@ public:
      */
     value_type& at(const size_type& m, const size_type& n)
     {
-        const size_type pos = m * this->_max_n + n;
-        if (pos > this->_max_m * this->_max_n)
+        if (!this->has(m, n))
             throw std::out_of_range("position is out of range");
-        return this->_data[pos];
+        return this->_data[m * this->_stride + n];
     }
 
     /**
@@ -380,10 +560,9 @@ public:
      */
     const value_type& at(const size_type& m, const size_type& n) const
     {
-        const size_type pos = m * this->_max_n + n;
-        if (pos > this->_max_m * this->_max_n)
+        if (!this->has(m, n))
             throw std::out_of_range("position is out of range");
-        return this->_data[pos];
+        return this->_data[m * this->_stride + n];
     }
 
     /**
@@ -394,7 +573,7 @@ public:
      * @return                      Reference to value at given coordinates
      */
     value_type& operator[](const shape_type& pos)
-        { return this->_data[pos.first * this->_max_n + pos.second]; }
+        { return this->_data[pos.first * this->_stride + pos.second]; }
 
     /**
      * Retrieves the element at the given coordinates
@@ -404,7 +583,7 @@ public:
      * @return                      Const reference to value at given coordinates
      */
     const value_type& operator[](const shape_type& pos) const
-        { return this->_data[pos.first * this->_max_n + pos.second]; }
+        { return this->_data[pos.first * this->_stride + pos.second]; }
 
     /**
      * Retrieves the shape of the matrix
@@ -454,6 +633,113 @@ public:
     constexpr size_type size() const noexcept
         { return this->_max_m * this->_max_n; }
 
+    /**
+     * Retrieves the distance between the starts of two consecutive rows,
+     * larger than the width when rows are padded
+     *
+     * @return                      Row stride, in elements
+     */
+    constexpr size_type stride() const noexcept
+        { return this->_stride; }
+
+    /**
+     * Retrieves the underlying row-major storage, rows being `stride()` apart
+     *
+     * @return                      Pointer to the first element
+     */
+    value_type * data() noexcept
+        { return this->_data; }
+
+    const value_type * data() const noexcept
+        { return this->_data; }
+
+    /**
+     * Views the whole matrix, without copying it
+     *
+     * @return                      View over the matrix
+     */
+    MatrixView<value_type> view() noexcept
+        { return MatrixView<value_type>(this->_data, this->_max_m, this->_max_n, this->_stride); }
+
+    MatrixView<const value_type> view() const noexcept
+        { return MatrixView<const value_type>(this->_data, this->_max_m, this->_max_n, this->_stride); }
+
+    /**
+     * Views a block of the matrix, without copying it. Writing through
+     * the view updates the matrix
+     *
+     * @param m                     First row of the block
+     * @param n                     First column of the block
+     * @param height                Amount of rows
+     * @param width                 Amount of columns
+     * @return                      View over the block
+     *
+     * @exception std::out_of_range Block does not fit within the matrix
+     */
+    MatrixView<value_type> block(const size_type& m, const size_type& n,
+                                 const size_type& height, const size_type& width)
+        { return this->view().block(m, n, height, width); }
+
+    MatrixView<const value_type> block(const size_type& m, const size_type& n,
+                                       const size_type& height, const size_type& width) const
+        { return this->view().block(m, n, height, width); }
+
+    /**
+     * Views a row of the matrix, without copying it
+     *
+     * @param m                     Row to view
+     * @return                      View over the row
+     *
+     * @exception std::out_of_range Row does not exist
+     */
+    VectorView<value_type> row(const size_type& m)
+        { return this->view().row(m); }
+
+    VectorView<const value_type> row(const size_type& m) const
+        { return this->view().row(m); }
+
+    /**
+     * Views a column of the matrix, without copying it
+     *
+     * @param n                     Column to view
+     * @return                      View over the column
+     *
+     * @exception std::out_of_range Column does not exist
+     */
+    VectorView<value_type> column(const size_type& n)
+        { return this->view().column(n); }
+
+    VectorView<const value_type> column(const size_type& n) const
+        { return this->view().column(n); }
+
+    /**
+     * Views the main diagonal of the matrix, without copying it
+     *
+     * @return                      View over the diagonal
+     */
+    VectorView<value_type> diagonal() noexcept
+        { return this->view().diagonal(); }
+
+    VectorView<const value_type> diagonal() const noexcept
+        { return this->view().diagonal(); }
+
+    /**
+     * Checks if the storage is borrowed from the caller, and thus never freed
+     * by the matrix (see Matrix::borrow())
+     *
+     * @return                      TRUE if borrowed, otherwise FALSE
+     */
+    bool borrowed() const noexcept
+        { return this->_external && !this->_owner; }
+
+    /**
+     * Retrieves a copy of the allocator used for the values
+     *
+     * @return                      Allocator
+     */
+    allocator_type get_allocator() const
+        { return this->_allocator; }
+
     /**
      * Checks if the given coordinates is within the bounds of the matrix
     *
@@ -496,12 +782,24 @@ public:
     Matrix transpose() const
     {
         Matrix result(this->_max_n, this->_max_m);
-        for (size_type m = 0; m < this->_max_m; ++m)
-            for (size_type n = 0; n < this->_max_n; ++n)
-                result[{n, m}] = (*this)[{m, n}];
+        maths::transpose::copy(this->_max_m, this->_max_n, this->_data, this->_stride,
+                               result._data, result._stride);
         return result;
     }
 
+    /**
+     * Transposes the matrix, in place for square matrices
+     *
+     * @exception std::bad_alloc    Allocation failure (non-square matrices only)
+     */
+    void transpose_inplace()
+    {
+        if (this->square())
+            maths::transpose::square(this->_max_m, this->_data, this->_stride);
+        else
+            *this = this->transpose();
+    }
+
     /**
      * Calculates the trace of a square matrix, denoted "tr(A)"
      * --> Sum of elements in main diagonal
@@ -530,8 +828,10 @@ public:
     {
         if (this->shape() != rhs.shape())
             return false;
-        for (size_type i = 0; i < this->size(); ++i)
-            if (this->_data[i] != rhs._data[i])
+        if (this->_stride == this->_max_n && rhs._stride == rhs._max_n)
+            return maths::simd::equal(this->_data, rhs._data, this->size());
+        for (size_type m = 0; m < this->_max_m; ++m)
+            if (!maths::simd::equal(this->_data + m * this->_stride, rhs._data + m * rhs._stride, this->_max_n))
                 return false;
         return true;
     }
@@ -567,9 +867,7 @@ public:
     Matrix absolute() const
     {
         Matrix tmp = *this;
-        for (size_type i = 0; i < this->size(); ++i)
-            if (tmp[i] < value_type())
-                tmp[i] = -tmp[i];
+        maths::simd::abs(tmp._data, tmp._capacity());
         return tmp;
     }
 
@@ -582,39 +880,23 @@ public:
      * @exception std::logic_error  Matrix is too wide to fit in a vector
      * @exception std::bad_alloc    Allocation failure
      */
-    Vector<value_type> to_vector() const
+    Vector<value_type, Alloc> to_vector() const
     {
         if (this->_max_n != 1)
             throw std::logic_error("matrix is too wide to be converted into vector");
-        return Vector<value_type>(*this);
+        return Vector<value_type, Alloc>(*this);
     }
 
     /**
      * Calculates the Reduced Row Echelon Form
-     * and applies on the current matrix
+     * and applies on the current matrix. Integer matrices are reduced without
+     * fractions (see maths::bareiss::row_echelon): rows are the smallest
+     * integer multiples of the reduced ones
+     *
+     * @exception std::overflow_error Integer minors do not fit in the value type
      */
     void row_echelon_inplace()
-    {
-        size_type n = 0;
-        for (size_type m = 0; m < this->_max_m; ++m)
-        {
-            if (n >= this->_max_n)
-                return;
-            size_type i = m;
-            while (this->at(i, n) == 0)
-                if (++i >= this->_max_m)
-                {
-                    i = m;
-                    if (++n >= this->_max_n)
-                        return;
-                }
-            this->swap_rows(i, m);
-            this->divide_row(m, this->at(m, n));
-            for (i = 0; i < this->_max_m; ++i)
-                if (i != m)
-                    this->fma_row(i, m, -this->at(i, n));
-        }
-    }
+        { this->_row_echelon(typename maths::elimination_of<value_type>::type()); }
 
     /**
      * Calculates the Reduced Row Echelon Form
@@ -659,10 +941,33 @@ public:
         case 3:
             return this->_det3x3();
         default:
-            return this->_detHigh();
+            return this->_detHigh(typename maths::elimination_of<value_type>::type());
         }
     }
 
+    /**
+     * Calculates the LU factorization with partial pivoting of the matrix,
+     * which can be reused for determinants and solving systems
+     *
+     * @return                      Factorization of the matrix
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    LU<value_type> lu() const
+        { return LU<value_type>(*this); }
+
+    /**
+     * Calculates the QR factorization with column pivoting of the matrix,
+     * which can be reused for ranks and least-squares problems
+     *
+     * @return                      Factorization of the matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    QR<value_type> qr() const
+        { return QR<value_type>(*this); }
+
     /**
      * Calculates the cofactor matrix of the matrix
      * and applies its result to the current matrix
@@ -694,11 +999,7 @@ public:
             this->at(1, 1) = a;
             break;
         default:
-            Matrix tmp = *this;
-            for (size_type m = 0; m < this->_max_m; ++m)
-                for (size_type n = 0; n < this->_max_n; ++n)
-                    tmp.at(m, n) = this->_single_cofactor(m, n);
-            *this = std::move(tmp);
+            this->_adjugate(maths::is_field<value_type>(), true);
         }
     }
 
@@ -727,8 +1028,13 @@ public:
      */
     void adjoint_inplace()
     {
-        this->cofactor_inplace();
-        *this = this->transpose();
+        if (this->_max_m < 3 || !this->square())
+        {
+            this->cofactor_inplace();
+            this->transpose_inplace();
+        }
+        else
+            this->_adjugate(maths::is_field<value_type>(), false);
     }
 
     /**
@@ -757,11 +1063,11 @@ public:
      */
     void inverse_inplace()
     {
-        value_type det = this->determinant();
-        if (!det)
-            throw std::runtime_error("determinant is 0");
-        this->adjoint_inplace();
-        *this *= 1. / det;
+        if (!this->_max_m || !this->_max_n)
+            return;
+        if (!this->square())
+            throw std::logic_error("inverse can only be calculated on square matrix");
+        this->_inverse(maths::is_field<value_type>());
     }
 
     /**
@@ -783,24 +1089,36 @@ public:
 
     /**
      * Calculates the rank of a matrix, representing the amount
-     * of independent rows / columns (or used dimension in vector space)
+     * of independent rows / columns (or used dimension in vector space).
+     * Floating matrices are factorized by QR with column pivoting, in the
+     * accumulator type, counting the diagonal elements of R that stand above
+     * the rounding errors of the stored type; integer matrices are eliminated exactly, without fractions,
+     * and matrices over exact fields (see Modular) by plain elimination
      *
      * @return                      Rank of current matrix
      *
      * @exception std::bad_alloc    Allocation failure
      */
     size_type rank() const
+        { return this->_rank(typename maths::elimination_of<value_type>::type()); }
+
+    /**
+     * Calculates the numerical rank of a matrix, through a QR factorization
+     * with column pivoting, as the amount of diagonal elements of R above
+     * `tolerance * |R(0, 0)|`
+     *
+     * @param tolerance             Relative magnitude under which R is negligible
+     * @return                      Rank of current matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    size_type rank(const double& tolerance) const
     {
-        Matrix tmp = this->row_echelon();
-        size_type rank = 0;
-        for (size_type m = 0; m < this->_max_m; ++m)
-            for (size_type n = 0; n < this->_max_n; ++n)
-                if (tmp.at(m, n) != 0)
-                {
-                    ++rank;
-                    break;
-                }
-        return rank;
+        using accumulator = typename std::conditional<maths::is_field<value_type>::value,
+            typename maths::accumulator<value_type>::type, double>::type;
+        maths::Arena::Scope scope;
+        return QR<accumulator, maths::ArenaAllocator<accumulator>>(*this)
+            .rank(static_cast<accumulator>(tolerance));
     }
 
     /**
@@ -897,13 +1215,44 @@ public:
     void scl(const value_type& rhs)
     { *this *= rhs; }
 
-    void mul_vec(const Vector<K>& rhs)
+    void mul_vec(const Vector<K, Alloc>& rhs)
     { *this *= rhs; }
 
     void mul_mat(const Matrix& rhs)
     { *this *= rhs; }
 
 private:
+    /**
+     * Checks if given expression has the same shape as the current matrix, otherwise
+     * throws a logic error exception
+     *
+     * @param other                 Expression to compare to
+     *
+     * @exception std::logic_error  Given expression is of different shape
+     */
+    template < class E >
+    void _check_shape(const E& other) const
+    {
+        if (this->_max_m != other.height() || this->_max_n != other.width())
+            throw std::logic_error("cannot operate with different matrix sizes");
+    }
+
+    /**
+     * Evaluates an expression into the current matrix. Element-wise expressions only
+     * read the position they write to, so the matrix may appear within it
+     *
+     * @param expr                  Expression to evaluate
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class E >
+    void _assign(const E& expr)
+    {
+        if (this->_max_m != expr.height() || this->_max_n != expr.width())
+            *this = Matrix(expr.height(), expr.width(), value_type(), this->_allocator);
+        maths::expr::evaluate(expr, this->_data, this->_stride, maths::expr::assign());
+    }
+
     /**
      * Calculates the determinant of a 2x2 matrix
      * (Used by Matrix.determinant() and Matrix._det3x3)
@@ -929,36 +1278,238 @@ private:
     }
 
     /**
-     * Calculates the determinant of a higher matrix
+     * Calculates the determinant of a higher matrix, in O(n^3) from its LU factorization
+     * carried in the accumulator type, so that the result is only rounded once.
+     * The factorization is a scratch one, taken from the current arena
      * (Used by Matrix.determinant())
      *
      * @return                      Determinant of given matrix
      */
-    value_type _detHigh() const
+    value_type _detHigh(maths::elimination::rounded) const
+    {
+        using accumulator = typename maths::accumulator<value_type>::type;
+        maths::Arena::Scope scope;
+        return static_cast<value_type>(LU<accumulator, maths::ArenaAllocator<accumulator>>(*this).determinant());
+    }
+
+    /**
+     * Calculates the determinant of a higher matrix exactly, in O(n^3), by
+     * fraction-free elimination of a scratch copy taken from the current arena,
+     * for types where divisions are not exact
+     * (Used by Matrix.determinant())
+     *
+     * @return                      Determinant of given matrix
+     *
+     * @exception std::overflow_error Minors do not fit in the value type
+     */
+    value_type _detHigh(maths::elimination::fraction_free) const
     {
         const size_type LEN = this->_max_n;
-        value_type result = value_type();
-        Matrix sub_matrix(LEN - 1, LEN - 1);
+        maths::Arena::Scope scope;
+        maths::Scratch<value_type> copy(LEN * LEN);
+        for (size_type m = 0; m < LEN; ++m)
+            std::copy(this->_data + m * this->_stride, this->_data + m * this->_stride + LEN,
+                      copy.get() + m * LEN);
+        return maths::bareiss::determinant(copy.get(), LEN, LEN);
+    }
+
+    /**
+     * Calculates the determinant of a higher matrix over an exact field, in O(n^3),
+     * by elimination of a scratch copy taken from the current arena
+     * (Used by Matrix.determinant())
+     *
+     * @return                      Determinant of given matrix
+     */
+    value_type _detHigh(maths::elimination::exact) const
+    {
+        const size_type LEN = this->_max_n;
+        maths::Arena::Scope scope;
+        maths::Scratch<value_type> copy(LEN * LEN);
+        for (size_type m = 0; m < LEN; ++m)
+            std::copy(this->_data + m * this->_stride, this->_data + m * this->_stride + LEN,
+                      copy.get() + m * LEN);
+        return maths::exact::determinant(copy.get(), LEN, LEN);
+    }
 
-        for (size_type i = 0; i < LEN; ++i)
+    /**
+     * Reduces the matrix by Gauss-Jordan elimination, with leading ones
+     * (used by Matrix.row_echelon_inplace())
+     */
+    void _row_echelon(maths::elimination::rounded)
+    {
+        size_type n = 0;
+        for (size_type m = 0; m < this->_max_m; ++m)
         {
-            size_type sub_n = 0;
-            for (size_type n = 0; n < LEN; ++n)
-            {
-                if (n == i)
-                    continue;
-                for (size_type m = 1; m < LEN; ++m)
-                    sub_matrix.at(m - 1, sub_n) = this->at(m, n);
-                ++sub_n;
-            }
-            value_type sub_result = (i % 2 ? -1 : 1) * sub_matrix.determinant();
-            result = maths::fma(sub_result, this->at(0, i), result);
+            if (n >= this->_max_n)
+                return;
+            size_type i = m;
+            while (this->at(i, n) == 0)
+                if (++i >= this->_max_m)
+                {
+                    i = m;
+                    if (++n >= this->_max_n)
+                        return;
+                }
+            this->swap_rows(i, m);
+            this->divide_row(m, this->at(m, n));
+            for (i = 0; i < this->_max_m; ++i)
+                if (i != m)
+                    this->fma_row(i, m, -this->at(i, n));
         }
-        return result;
     }
 
     /**
-     * Calculates the cofactor for a singular cell located on a 3x3 matrix or higher
+     * Reduces the matrix by fraction-free Gauss-Jordan elimination
+     * (used by Matrix.row_echelon_inplace())
+     */
+    void _row_echelon(maths::elimination::fraction_free)
+    {
+        if (this->_max_m && this->_max_n)
+            maths::bareiss::row_echelon(this->_data, this->_max_m, this->_max_n, this->_stride);
+    }
+
+    /**
+     * Reduces the matrix by blocked elimination over an exact field, with leading ones
+     * (used by Matrix.row_echelon_inplace())
+     */
+    void _row_echelon(maths::elimination::exact)
+    {
+        if (this->_max_m && this->_max_n)
+            maths::exact::row_echelon(this->_data, this->_max_m, this->_max_n, this->_stride);
+    }
+
+    /**
+     * Calculates the rank through a QR factorization with column pivoting,
+     * carried in the accumulator type. The tolerance stays the one of the
+     * stored type (`max(m, n) * epsilon`), as its values already carry its
+     * rounding errors. The factorization is a scratch one, taken from the
+     * current arena (used by Matrix.rank())
+     */
+    size_type _rank(maths::elimination::rounded) const
+    {
+        using accumulator = typename maths::accumulator<value_type>::type;
+        const accumulator tolerance = static_cast<accumulator>(std::max(this->_max_m, this->_max_n))
+                                    * static_cast<accumulator>(std::numeric_limits<value_type>::epsilon());
+        maths::Arena::Scope scope;
+        return QR<accumulator, maths::ArenaAllocator<accumulator>>(*this).rank(tolerance);
+    }
+
+    /**
+     * Calculates the rank exactly, by fraction-free elimination
+     * of a scratch copy (used by Matrix.rank())
+     */
+    size_type _rank(maths::elimination::fraction_free) const
+    {
+        maths::Arena::Scope scope;
+        maths::Scratch<value_type> copy(this->_max_m * this->_max_n);
+        for (size_type m = 0; m < this->_max_m; ++m)
+            std::copy(this->_data + m * this->_stride, this->_data + m * this->_stride + this->_max_n,
+                      copy.get() + m * this->_max_n);
+        bool odd;
+        return maths::bareiss::eliminate(copy.get(), this->_max_m, this->_max_n, this->_max_n, false, odd);
+    }
+
+    /**
+     * Calculates the rank by blocked elimination over an exact field,
+     * of a scratch copy (used by Matrix.rank())
+     */
+    size_type _rank(maths::elimination::exact) const
+    {
+        maths::Arena::Scope scope;
+        maths::Scratch<value_type> copy(this->_max_m * this->_max_n);
+        for (size_type m = 0; m < this->_max_m; ++m)
+            std::copy(this->_data + m * this->_stride, this->_data + m * this->_stride + this->_max_n,
+                      copy.get() + m * this->_max_n);
+        std::vector<size_type> columns;
+        bool odd;
+        return maths::exact::eliminate(copy.get(), this->_max_m, this->_max_n, this->_max_n, columns, odd);
+    }
+
+    /**
+     * Calculates the inverse matrix in O(n^3) from the LU factorization,
+     * carried in the accumulator type
+     * (Used by Matrix.inverse_inplace())
+     *
+     * @exception std::runtime_error Matrix is singular
+     */
+    void _inverse(std::true_type)
+    {
+        using accumulator = typename maths::accumulator<value_type>::type;
+        this->_take(LU<accumulator>(*this).inverse());
+    }
+
+    /**
+     * Calculates the inverse matrix from its adjoint,
+     * for types where divisions are not exact
+     * (Used by Matrix.inverse_inplace())
+     *
+     * @exception std::runtime_error Determinant is 0
+     */
+    void _inverse(std::false_type)
+    {
+        value_type det = this->determinant();
+        if (!det)
+            throw std::runtime_error("determinant is 0");
+        this->adjoint_inplace();
+        *this *= 1. / det;
+    }
+
+    /**
+     * Calculates the cofactor matrix (or its transpose, the adjoint) of
+     * a 3x3 matrix or higher as `det(A) * inverse(A)`, in O(n^3).
+     * Matrices without an inverse still have non-zero cofactors, which are
+     * then calculated one by one
+     * (Used by Matrix.cofactor_inplace() and Matrix.adjoint_inplace())
+     *
+     * @param cofactor              TRUE for the cofactor matrix, FALSE for the adjoint
+     */
+    void _adjugate(std::true_type, const bool& cofactor)
+    {
+        using accumulator = typename maths::accumulator<value_type>::type;
+        maths::Arena::Scope scope;
+        LU<accumulator, maths::ArenaAllocator<accumulator>> lu(*this);
+        if (!lu.invertible())
+            return this->_adjugate(std::false_type(), cofactor);
+
+        const accumulator det = lu.determinant();
+        const Matrix<accumulator, maths::ArenaAllocator<accumulator>> inverse = std::move(lu).inverse();
+        for (size_type m = 0; m < this->_max_m; ++m)
+            for (size_type n = 0; n < this->_max_n; ++n)
+                this->at(m, n) = static_cast<value_type>(det * (cofactor ? inverse.at(n, m) : inverse.at(m, n)));
+    }
+
+    /**
+     * Calculates the cofactor matrix (or the adjoint) one cell at a time
+     * (Used by Matrix.cofactor_inplace() and Matrix.adjoint_inplace())
+     *
+     * @param cofactor              TRUE for the cofactor matrix, FALSE for the adjoint
+     */
+    void _adjugate(std::false_type, const bool& cofactor)
+    {
+        Matrix tmp(this->_max_m, this->_max_n);
+        for (size_type m = 0; m < this->_max_m; ++m)
+            for (size_type n = 0; n < this->_max_n; ++n)
+                (cofactor ? tmp.at(m, n) : tmp.at(n, m)) = this->_single_cofactor(m, n);
+        *this = std::move(tmp);
+    }
+
+    /**
+     * Takes over the values of a matrix of the same shape
+     */
+    void _take(Matrix&& other) noexcept
+        { *this = std::move(other); }
+
+    template < class T, class A >
+    void _take(const Matrix<T, A>& other)
+    {
+        for (size_type m = 0; m < this->_max_m; ++m)
+            for (size_type n = 0; n < this->_max_n; ++n)
+                this->at(m, n) = static_cast<value_type>(other.at(m, n));
+    }
+
+    /**
+     * Calculates the cofactor for a singular cell located on a 3x3 matrix or higher,
+     * from a scratch minor taken from the current arena
      *
      * @param row                   Cell's row
      * @param column                Cell's column
@@ -967,7 +1518,8 @@ private:
     value_type _single_cofactor(const size_type& row, const size_type& column) const
     {
         const size_type LEN = this->_max_n;
-        Matrix sub_matrix(LEN - 1, LEN - 1);
+        maths::Arena::Scope scope;
+        Matrix<value_type, maths::ArenaAllocator<value_type>> sub_matrix(LEN - 1, LEN - 1);
 
         size_type sub_n = 0;
         for (size_type n = 0; n < LEN; ++n)
@@ -988,12 +1540,155 @@ private:
         return sub_matrix.determinant() * ((row + column) % 2 ? -1 : 1);
     }
 
-protected:
-    friend Vector<value_type>;
+    using traits = std::allocator_traits<Alloc>;
+
+    /**
+     * Calculates the row stride of a matrix, padding rows to the allocator's
+     * requested boundary (vectors and single rows are never padded)
+     */
+    static size_type _stride_of(const size_type& height, const size_type& width) noexcept
+    {
+        constexpr size_type padding = maths::row_padding<Alloc>::value;
+        constexpr size_type step = padding % sizeof(value_type) ? 1 : padding / sizeof(value_type);
+        if (step < 2 || height < 2 || width < 2)
+            return width;
+        return (width + step - 1) / step * step;
+    }
+
+    /**
+     * Retrieves the amount of allocated values, padding included
+     */
+    constexpr size_type _capacity() const noexcept
+        { return this->_max_m * this->_stride; }
 
-    size_type       _max_m; // Matrix height (amount of rows)
-    size_type       _max_n; // Matrix width (amount of columns)
-    value_type *    _data;  // Matrix content
+    /**
+     * Checks if both matrices may be processed as flat arrays of `_capacity()`
+     * values: rows are equally spaced, and any padding between them belongs
+     * to the matrices (external storage may interleave foreign data)
+     */
+    bool _flat(const Matrix& other) const noexcept
+    {
+        return this->_stride == other._stride
+            && (this->_stride == this->_max_n || (!this->_external && !other._external));
+    }
+
+    /**
+     * Constructs a matrix over external storage
+     *
+     * @exception std::logic_error  Stride is lower than the width
+     */
+    Matrix(value_type * data, const size_type& height, const size_type& width, const size_type& stride,
+           std::shared_ptr<void> owner):
+        _max_m(height), _max_n(width), _stride(stride ? stride : width), _allocator(), _data(data),
+        _owner(std::move(owner)), _external(true)
+    {
+        if (this->_stride < width)
+            throw std::logic_error("stride cannot be lower than the width");
+    }
+
+    /**
+     * Creates a matrix adopting the storage of a row-major array
+     *
+     * @exception std::out_of_range Given array is missing values
+     * @exception std::bad_alloc    Allocation failure
+     */
+    static Matrix _adopt(const size_type& height, const size_type& width, std::vector<value_type>&& data)
+    {
+        if (data.size() < height * width)
+            throw std::out_of_range("array is missing values");
+        std::shared_ptr<std::vector<value_type>> owner = std::make_shared<std::vector<value_type>>(std::move(data));
+        value_type * values = owner->data();
+        return Matrix(values, height, width, width, std::move(owner));
+    }
+
+    /**
+     * Allocates and constructs values through the allocator
+     *
+     * @param allocator             Allocator to use
+     * @param count                 Amount of values
+     * @param init                  Provides the value of each position
+     * @return                      Constructed values (nullptr when empty)
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class F >
+    static value_type * _create(Alloc& allocator, const size_type& count, const F& init)
+    {
+        if (!count)
+            return nullptr;
+        value_type * data = traits::allocate(allocator, count);
+        size_type i = 0;
+        try
+        {
+            for (; i < count; ++i)
+                traits::construct(allocator, data + i, init(i));
+        }
+        catch (...)
+        {
+            while (i--)
+                traits::destroy(allocator, data + i);
+            traits::deallocate(allocator, data, count);
+            throw;
+        }
+        return data;
+    }
+
+    template < class F >
+    value_type * _create(const F& init)
+        { return Matrix::_create(this->_allocator, this->_capacity(), init); }
+
+    /**
+     * Allocates a copy of the values of a matrix, laid out with the given row stride
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    static value_type * _create(Alloc& allocator, const Matrix& other, const size_type& stride)
+    {
+        if (stride == other._stride && (!other._external || stride == other._max_n))
+            return Matrix::_create(allocator, other._max_m * stride,
+                [&other](const size_type& i) -> const value_type& { return other._data[i]; });
+
+        const value_type padding = value_type();
+        return Matrix::_create(allocator, other._max_m * stride,
+            [&other, &stride, &padding](const size_type& i) -> const value_type& {
+                const size_type n = i % stride;
+                return n < other._max_n ? other._data[i / stride * other._stride + n] : padding;
+            });
+    }
+
+    /**
+     * Destroys and deallocates the values
+     */
+    void _release() noexcept
+    {
+        if (!this->_data)
+            return;
+        if (this->_external)
+        {
+            this->_owner.reset();
+            this->_external = false;
+            this->_data = nullptr;
+            return;
+        }
+        for (size_type i = 0; i < this->_capacity(); ++i)
+            traits::destroy(this->_allocator, this->_data + i);
+        traits::deallocate(this->_allocator, this->_data, this->_capacity());
+        this->_data = nullptr;
+    }
+
+protected:
+    friend Vector<value_type, Alloc>;
+
+    template < class, class >
+    friend class Matrix;
+
+    size_type               _max_m;     // Matrix height (amount of rows)
+    size_type               _max_n;     // Matrix width (amount of columns)
+    size_type               _stride;    // Distance between rows (at least the width)
+    allocator_type          _allocator; // Allocator of the content
+    value_type *            _data;      // Matrix content
+    std::shared_ptr<void>   _owner;     // Keeps adopted external content alive (none when borrowed)
+    bool                    _external;  // Whether the content comes from outside the allocator
 };
 
 /**
@@ -1005,8 +1700,8 @@ protected:
  * @param rhs       Matrix to compute
  * @return          New matrix containing result
  */
-template < class K >
-Matrix<K> operator*(const typename Matrix<K>::value_type& lhs, const Matrix<K>& rhs) noexcept
+template < class K, class A >
+Matrix<K, A> operator*(const typename Matrix<K, A>::value_type& lhs, const Matrix<K, A>& rhs)
     { return rhs.operator*(lhs); }
 
 /**
@@ -1017,8 +1712,8 @@ Matrix<K> operator*(const typename Matrix<K>::value_type& lhs, const Matrix<K>&
  * @param value     Matrix to write
  * @return          Returns output stream for chaining
  */
-template < class K >
-std::ostream& operator<<(std::ostream& out, const Matrix<K>& value)
+template < class K, class A >
+std::ostream& operator<<(std::ostream& out, const Matrix<K, A>& value)
 {
     const size_t max_m = value.shape().first;
     const size_t max_n = value.shape().second;
@@ -1033,6 +1728,11 @@ std::ostream& operator<<(std::ostream& out, const Matrix<K>& value)
     return out;
 }
 
+#include "LU.hpp"
+#include "QR.hpp"
+#include "FixedMatrix.hpp"
+#include "MatrixView.hpp"
+
 using f64Matrix = Matrix<double>;               // Helper type for double Matrix
 using i64Matrix = Matrix<long long>;            // Helper type for long Matrix
 using u64Matrix = Matrix<unsigned long long>;   // Helper type for unsigned long Matrix
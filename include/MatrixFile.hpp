@@ -0,0 +1,701 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - MatrixFile.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [1:05 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef MATRIXFILE_HPP
+#define MATRIXFILE_HPP
+
+#include <cmath>
+#include <cerrno>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Matrix.hpp"
+
+/**
+ * Binary matrix files, made of a 64-byte header followed by the values:
+ *
+ *  offset  size  field
+ *  0       4     magic "MTRX"
+ *  4       2     version (1)
+ *  6       2     byte order mark 0x0102, in the byte order of the values
+ *  8       1     element type (see file::DType)
+ *  9       1     layout (see file::Layout)
+ *  10      2     reserved (0)
+ *  12      4     alignment of the values within the file, in bytes
+ *  16      8     height
+ *  24      8     width
+ *  32      8     stride, in elements, between two rows (columns when column-major)
+ *  40      8     offset of the values from the start of the file
+ *  48      16    reserved (0)
+ *
+ * Files are written in native byte order, and rejected by machines of another
+ * order. Row-major files may be mapped in memory, as a matrix (see file::map())
+ * or a read-only view (see file::view()), whose pages are only read from the
+ * disk once accessed
+ */
+namespace maths
+{
+namespace file
+{
+    /**
+     * Element types of a file
+     */
+    enum class DType: std::uint8_t
+    {
+        int8 = 1, uint8, int16, uint16, int32, uint32, int64, uint64, float32, float64
+    };
+
+    /**
+     * Order in which the values of a file are stored
+     */
+    enum class Layout: std::uint8_t
+    {
+        row_major = 0,
+        column_major = 1
+    };
+
+    /**
+     * Access granted by a mapping
+     */
+    enum class Mode
+    {
+        read_only,      // Only viewed, without write access (see file::view())
+        copy_on_write,  // Written pages become private copies, the file is left untouched
+        read_write      // Writes go through to the file
+    };
+
+    /**
+     * Paging hint given to the kernel for a mapping (see madvise(2))
+     */
+    enum class Advice
+    {
+        normal,         // Default read-ahead
+        sequential,     // Aggressive read-ahead, for a single pass in order
+        random,         // No read-ahead, for scattered accesses
+        willneed        // Starts reading the whole file in the background
+    };
+
+    // Element type stored for T, only defined for supported types
+    template < class T, class = void >
+    struct dtype_of;
+
+    template < class T >
+    struct dtype_of<T, typename std::enable_if<std::is_integral<T>::value
+                                               && !std::is_same<T, bool>::value && sizeof(T) <= 8>::type>
+    {
+        static constexpr DType value = static_cast<DType>(
+            (sizeof(T) == 1 ? 1 : sizeof(T) == 2 ? 3 : sizeof(T) == 4 ? 5 : 7) + !std::is_signed<T>::value);
+    };
+
+    template <>
+    struct dtype_of<float> { static constexpr DType value = DType::float32; };
+
+    template <>
+    struct dtype_of<double> { static constexpr DType value = DType::float64; };
+
+    /**
+     * Header of a matrix file
+     */
+    struct Header
+    {
+        char            magic[4];
+        std::uint16_t   version;
+        std::uint16_t   byte_order;
+        DType           dtype;
+        Layout          layout;
+        std::uint16_t   reserved0;
+        std::uint32_t   alignment;
+        std::uint64_t   height;
+        std::uint64_t   width;
+        std::uint64_t   stride;
+        std::uint64_t   offset;
+        std::uint64_t   reserved1[2];
+    };
+
+    static_assert(sizeof(Header) == 64, "matrix file header must be 64 bytes");
+
+    constexpr std::uint16_t VERSION = 1;
+    constexpr std::uint16_t BYTE_ORDER_MARK = 0x0102;
+
+    /**
+     * Closes a file descriptor on destruction
+     */
+    class Descriptor
+    {
+    public:
+        /**
+         * Opens the given file (see open(2))
+         *
+         * @exception std::system_error The file could not be opened
+         */
+        Descriptor(const std::string& path, const int& flags, const mode_t& mode = 0644):
+            _fd(::open(path.c_str(), flags | O_CLOEXEC, mode))
+        {
+            if (this->_fd < 0)
+                throw std::system_error(errno, std::generic_category(), "cannot open " + path);
+        }
+
+        ~Descriptor()
+            { ::close(this->_fd); }
+
+        Descriptor(const Descriptor&) = delete;
+        Descriptor& operator=(const Descriptor&) = delete;
+
+        int get() const noexcept
+            { return this->_fd; }
+
+        /**
+         * Retrieves the size of the file in bytes
+         *
+         * @exception std::system_error The file could not be inspected
+         */
+        std::uint64_t size() const
+        {
+            struct stat info;
+            if (::fstat(this->_fd, &info))
+                throw std::system_error(errno, std::generic_category(), "cannot inspect matrix file");
+            return static_cast<std::uint64_t>(info.st_size);
+        }
+
+        /**
+         * Writes the whole given buffer at the current position
+         *
+         * @exception std::system_error The buffer could not be written
+         */
+        void write(const void * data, size_t bytes) const
+        {
+            const char * cursor = static_cast<const char*>(data);
+            while (bytes)
+            {
+                const ssize_t written = ::write(this->_fd, cursor, bytes);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    throw std::system_error(errno, std::generic_category(), "cannot write matrix file");
+                cursor += written;
+                bytes -= static_cast<size_t>(written);
+            }
+        }
+
+        /**
+         * Writes the whole given buffer at the given offset
+         *
+         * @exception std::system_error The buffer could not be written
+         */
+        void write(const void * data, size_t bytes, std::uint64_t offset) const
+        {
+            const char * cursor = static_cast<const char*>(data);
+            while (bytes)
+            {
+                const ssize_t written = ::pwrite(this->_fd, cursor, bytes, static_cast<off_t>(offset));
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    throw std::system_error(errno, std::generic_category(), "cannot write matrix file");
+                cursor += written;
+                offset += static_cast<std::uint64_t>(written);
+                bytes -= static_cast<size_t>(written);
+            }
+        }
+
+        /**
+         * Reads exactly the given amount of bytes at the given offset
+         *
+         * @exception std::system_error     The file could not be read
+         * @exception std::runtime_error    The file ended first
+         */
+        void read(void * data, size_t bytes, std::uint64_t offset) const
+        {
+            char * cursor = static_cast<char*>(data);
+            while (bytes)
+            {
+                const ssize_t got = ::pread(this->_fd, cursor, bytes, static_cast<off_t>(offset));
+                if (got < 0 && errno == EINTR)
+                    continue;
+                if (got < 0)
+                    throw std::system_error(errno, std::generic_category(), "cannot read matrix file");
+                if (!got)
+                    throw std::runtime_error("matrix file is truncated");
+                cursor += got;
+                offset += static_cast<std::uint64_t>(got);
+                bytes -= static_cast<size_t>(got);
+            }
+        }
+
+    private:
+        int _fd;    // File descriptor
+    };
+
+    /**
+     * Reads and validates the header of a file holding values of type K
+     *
+     * @param file                      File to read from
+     * @return                          Header of the file
+     *
+     * @exception std::runtime_error    Not a matrix file, or a damaged one
+     * @exception std::logic_error      The file holds another element type
+     * @exception std::system_error     The file could not be read
+     */
+    template < class K >
+    Header read_header(const Descriptor& file)
+    {
+        const std::uint64_t size = file.size();
+        if (size < sizeof(Header))
+            throw std::runtime_error("not a matrix file");
+        Header header;
+        file.read(&header, sizeof(Header), 0);
+
+        if (std::memcmp(header.magic, "MTRX", 4))
+            throw std::runtime_error("not a matrix file");
+        if (header.version != VERSION)
+            throw std::runtime_error("unsupported matrix file version");
+        if (header.byte_order != BYTE_ORDER_MARK)
+            throw std::runtime_error("matrix file has a foreign byte order");
+        if (header.layout != Layout::row_major && header.layout != Layout::column_major)
+            throw std::runtime_error("matrix file has an unknown layout");
+        if (header.dtype != dtype_of<K>::value)
+            throw std::logic_error("matrix file holds another element type");
+
+        const bool rows = header.layout == Layout::row_major;
+        const std::uint64_t lines = rows ? header.height : header.width;
+        const std::uint64_t length = rows ? header.width : header.height;
+        if (header.stride < length || header.offset < sizeof(Header) || header.offset > size
+            || header.offset % sizeof(K))
+            throw std::runtime_error("matrix file header is corrupted");
+        const std::uint64_t elements = (size - header.offset) / sizeof(K);
+        if (lines && length && (elements < length || (lines - 1) > (elements - length) / header.stride))
+            throw std::runtime_error("matrix file is truncated");
+        return header;
+    }
+
+    /**
+     * Creates the header of a row-major file of packed rows
+     *
+     * @param height                    Height of the matrix
+     * @param width                     Width of the matrix
+     * @param alignment                 Alignment of the values within the file, a power of 2
+     * @return                          Header of the file
+     *
+     * @exception std::logic_error      Alignment is not a power of 2
+     */
+    template < class K >
+    Header make_header(const std::uint64_t& height, const std::uint64_t& width, const std::uint32_t& alignment)
+    {
+        if (!alignment || alignment & (alignment - 1))
+            throw std::logic_error("alignment must be a power of 2");
+
+        Header header = Header();
+        std::memcpy(header.magic, "MTRX", 4);
+        header.version = VERSION;
+        header.byte_order = BYTE_ORDER_MARK;
+        header.dtype = dtype_of<K>::value;
+        header.layout = Layout::row_major;
+        header.alignment = alignment;
+        header.height = height;
+        header.width = width;
+        header.stride = width;
+        header.offset = (sizeof(Header) + alignment - 1) / alignment * alignment;
+        return header;
+    }
+
+    /**
+     * Writes a header at the start of a file, followed by the padding up to the values
+     *
+     * @exception std::system_error     The file could not be written
+     */
+    inline void write_header(const Descriptor& file, const Header& header)
+    {
+        file.write(&header, sizeof(Header));
+        const std::vector<char> padding(header.offset - sizeof(Header));
+        file.write(padding.data(), padding.size());
+    }
+
+    /**
+     * Writes a matrix to a file in row-major order, replacing it if it exists
+     *
+     * @param path                      Path of the file
+     * @param matrix                    Matrix to write
+     * @param alignment                 Alignment of the values within the file, a power of 2
+     *                                  (raise it to the page size to allow huge pages mappings)
+     *
+     * @exception std::logic_error      Alignment is not a power of 2
+     * @exception std::system_error     The file could not be written
+     */
+    template < class K, class A >
+    void save(const std::string& path, const Matrix<K, A>& matrix, const std::uint32_t& alignment = 64)
+    {
+        const Header header = make_header<K>(matrix.height(), matrix.width(), alignment);
+        const Descriptor file(path, O_WRONLY | O_CREAT | O_TRUNC);
+        write_header(file, header);
+        for (size_t m = 0; m < matrix.height(); ++m)
+            file.write(matrix.data() + m * matrix.stride(), matrix.width() * sizeof(K));
+    }
+
+    /**
+     * Reads a matrix from a file into memory of its own
+     *
+     * @param path                      Path of the file
+     * @return                          Matrix read
+     *
+     * @exception std::runtime_error    Not a matrix file, or a damaged one
+     * @exception std::logic_error      The file holds another element type
+     * @exception std::system_error     The file could not be read
+     * @exception std::bad_alloc        Allocation failure
+     */
+    template < class K, class A = maths::AlignedAllocator<K> >
+    Matrix<K, A> load(const std::string& path)
+    {
+        const Descriptor file(path, O_RDONLY);
+        const Header header = read_header<K>(file);
+
+        const bool rows = header.layout == Layout::row_major;
+        Matrix<K, A> result(rows ? header.height : header.width, rows ? header.width : header.height);
+        for (size_t m = 0; m < result.height(); ++m)
+            file.read(result.data() + m * result.stride(), result.width() * sizeof(K),
+                      header.offset + m * header.stride * sizeof(K));
+        if (!rows)
+            result.transpose_inplace();
+        return result;
+    }
+
+    /**
+     * Maps the values of a row-major file in memory, unmapped once the last
+     * owner is destroyed (none for an empty matrix)
+     *
+     * @param path                      Path of the file
+     * @param mode                      Access granted to the pages
+     * @param advice                    Paging hint for the whole mapping
+     * @param header                    Header of the file, read from it
+     * @return                          Owner of the mapping, pointing to the first value
+     *
+     * @exception std::runtime_error    Not a matrix file, or a damaged one
+     * @exception std::logic_error      The file holds another element type, or is column-major
+     * @exception std::system_error     The file could not be opened or mapped
+     */
+    template < class K >
+    std::shared_ptr<K> map_values(const std::string& path, const Mode& mode, const Advice& advice, Header& header)
+    {
+        const Descriptor file(path, mode == Mode::read_write ? O_RDWR : O_RDONLY);
+        header = read_header<K>(file);
+        if (header.layout != Layout::row_major)
+            throw std::logic_error("cannot map a column-major matrix file");
+        if (!header.height || !header.width)
+            return std::shared_ptr<K>();
+
+        const size_t length = static_cast<size_t>(header.offset
+                            + ((header.height - 1) * header.stride + header.width) * sizeof(K));
+        const int protection = mode == Mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+        void * base = ::mmap(nullptr, length, protection,
+                             mode == Mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED, file.get(), 0);
+        if (base == MAP_FAILED)
+            throw std::system_error(errno, std::generic_category(), "cannot map " + path);
+
+        static const int advices[] = { MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED };
+        ::madvise(base, length, advices[static_cast<int>(advice)]);
+
+        K * data = reinterpret_cast<K*>(static_cast<char*>(base) + header.offset);
+        try
+        {
+            return std::shared_ptr<K>(data, [base, length](K *) { ::munmap(base, length); });
+        }
+        catch (...)
+        {
+            ::munmap(base, length);
+            throw;
+        }
+    }
+
+    /**
+     * Maps a row-major file in memory as a writable matrix, without reading
+     * it: pages are read from the disk on first access, and may be evicted
+     * again under memory pressure. The mapping lasts until the matrix and its
+     * moved-to instances are destroyed (copies are read into memory of their
+     * own). Read-only mappings are only viewed (see file::view())
+     *
+     * @param path                      Path of the file
+     * @param mode                      Access granted to the matrix, copy-on-write or read-write
+     * @param advice                    Paging hint for the whole mapping
+     * @return                          Matrix over the mapped values
+     *
+     * @exception std::runtime_error    Not a matrix file, or a damaged one
+     * @exception std::logic_error      The file holds another element type, or is column-major,
+     *                                  or the mode is read-only
+     * @exception std::system_error     The file could not be opened or mapped
+     */
+    template < class K, class A = maths::AlignedAllocator<K> >
+    Matrix<K, A> map(const std::string& path, const Mode& mode = Mode::copy_on_write,
+                     const Advice& advice = Advice::normal)
+    {
+        if (mode == Mode::read_only)
+            throw std::logic_error("cannot map a read-only matrix, view it instead");
+        Header header;
+        const std::shared_ptr<K> values = map_values<K>(path, mode, advice, header);
+        if (!values)
+            return Matrix<K, A>(header.height, header.width);
+        return Matrix<K, A>::adopt(values.get(), header.height, header.width, header.stride,
+                                   [values](K *) {});
+    }
+
+    /**
+     * Read-only mapping of a file (see file::view()), alive for as long as
+     * the mapping or any of its copies exist: its view, and the views taken
+     * from it, must not outlive them
+     *
+     * @tparam K    Element type
+     */
+    template < class K >
+    class Mapping
+    {
+    public:
+        Mapping(const std::shared_ptr<K>& values, const Header& header) noexcept:
+            _values(values), _view(values.get(), header.height, header.width, header.stride) {}
+
+        /**
+         * Retrieves the constant view over the mapped values, which are
+         * read into a matrix of their own through its eval()
+         *
+         * @return                      View over the values
+         */
+        const MatrixView<const K>& view() const noexcept
+            { return this->_view; }
+
+    private:
+        std::shared_ptr<K>      _values;    // Owner of the mapping
+        MatrixView<const K>     _view;      // View over the mapped values
+    };
+
+    /**
+     * Maps a row-major file in memory as a read-only view, without reading
+     * it: pages are read from the disk on first access, and may be evicted
+     * again under memory pressure. Values can only be read through the view,
+     * as the pages are mapped without write access
+     *
+     * @param path                      Path of the file
+     * @param advice                    Paging hint for the whole mapping
+     * @return                          Mapping, viewing the values
+     *
+     * @exception std::runtime_error    Not a matrix file, or a damaged one
+     * @exception std::logic_error      The file holds another element type, or is column-major
+     * @exception std::system_error     The file could not be opened or mapped
+     */
+    template < class K >
+    Mapping<K> view(const std::string& path, const Advice& advice = Advice::normal)
+    {
+        Header header;
+        const std::shared_ptr<K> values = map_values<K>(path, Mode::read_only, advice, header);
+        return Mapping<K>(values, header);
+    }
+
+    /**
+     * Hints the kernel that rows of a matrix will soon be needed, so that
+     * mapped ones are read from the disk in the background (does nothing
+     * for memory already resident)
+     *
+     * @param matrix                    View, usually over a mapping (see file::view())
+     * @param row                       First row needed
+     * @param count                     Amount of rows needed
+     */
+    template < class K >
+    void prefetch(const MatrixView<const K>& matrix, const size_t& row, size_t count) noexcept
+    {
+        if (row >= matrix.height() || !count || !matrix.width())
+            return;
+        if (count > matrix.height() - row)
+            count = matrix.height() - row;
+
+        static const std::uintptr_t page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(matrix.data() + row * matrix.stride());
+        const std::uintptr_t last = reinterpret_cast<std::uintptr_t>(
+            matrix.data() + (row + count - 1) * matrix.stride() + matrix.width());
+        const std::uintptr_t start = first & ~(page - 1);
+        ::madvise(reinterpret_cast<void*>(start), last - start, MADV_WILLNEED);
+    }
+
+    template < class K, class A >
+    void prefetch(const Matrix<K, A>& matrix, const size_t& row, const size_t& count) noexcept
+        { prefetch(MatrixView<const K>(matrix), row, count); }
+
+    /**
+     * Reads a block of a row-major file into a buffer
+     *
+     * @param file                      File to read from
+     * @param header                    Header of the file
+     * @param row                       First row of the block
+     * @param column                    First column of the block
+     * @param height                    Height of the block
+     * @param width                     Width of the block
+     * @param out                       Buffer receiving the block
+     * @param ld                        Row stride of the buffer
+     *
+     * @exception std::system_error     The file could not be read
+     * @exception std::runtime_error    The file ended first
+     */
+    template < class K >
+    void read_block(const Descriptor& file, const Header& header,
+                    const size_t& row, const size_t& column, const size_t& height, const size_t& width,
+                    K * out, const size_t& ld)
+    {
+        const std::uint64_t start = header.offset + (row * header.stride + column) * sizeof(K);
+        if (width == header.stride && width == ld)
+            return file.read(out, height * width * sizeof(K), start);
+        for (size_t m = 0; m < height; ++m)
+            file.read(out + m * ld, width * sizeof(K), start + m * header.stride * sizeof(K));
+    }
+
+    /**
+     * Calculates the product of two matrices stored in row-major files into a
+     * third file, for operands too large to be held in memory. The operands are
+     * streamed in tiles, the next ones being read in the background while the
+     * current ones are multiplied, and each tile of the result is written once
+     * complete. Results match the in-memory product (see Matrix::operator*=()),
+     * tiles being cut along the blocking of the multiplication engine
+     *
+     * @param lhs                       Path of the left operand (m x k)
+     * @param rhs                       Path of the right operand (k x n)
+     * @param out                       Path of the result (m x n), replaced if it exists
+     * @param budget                    Memory available to the tiles, in bytes
+     * @param alignment                 Alignment of the values within the result file
+     *
+     * @exception std::logic_error      Operands are incompatible for multiplication, column-major,
+     *                                  of another element type, or the budget cannot hold a tile
+     * @exception std::runtime_error    An operand is not a matrix file, or a damaged one
+     * @exception std::system_error     A file could not be read or written
+     * @exception std::bad_alloc        Allocation failure
+     */
+    template < class K >
+    void multiply(const std::string& lhs, const std::string& rhs, const std::string& out,
+                  const size_t& budget, const std::uint32_t& alignment = 64)
+    {
+        constexpr size_t MR = maths::gemm::blocking<K>::MR;
+        constexpr size_t NR = maths::gemm::blocking<K>::NR;
+        constexpr size_t KC = maths::gemm::blocking<K>::KC;
+
+        const Descriptor file_a(lhs, O_RDONLY);
+        const Descriptor file_b(rhs, O_RDONLY);
+        const Header header_a = read_header<K>(file_a);
+        const Header header_b = read_header<K>(file_b);
+        if (header_a.layout != Layout::row_major || header_b.layout != Layout::row_major)
+            throw std::logic_error("cannot stream a column-major matrix file");
+        if (header_a.width != header_b.height)
+            throw std::logic_error("incompatible for multiplication");
+        const size_t m = header_a.height, n = header_b.width, k = header_a.width;
+
+        // Sizes the tiles so that two sets of operand tiles (one being multiplied,
+        // one being read) and a result tile fit the budget: 2(tm.tk + tk.tn) + tm.tn.
+        // Tiles are cut at multiples of the engine blocking, keeping its summation order
+        const double elements = static_cast<double>(budget / sizeof(K));
+        const size_t side = static_cast<size_t>(std::sqrt(elements / 5));
+        const size_t tk = k <= side ? k : std::min(k, std::max(KC, side / KC * KC));
+        const double depth = static_cast<double>(tk);
+        size_t tm = static_cast<size_t>(std::sqrt(4 * depth * depth + elements) - 2 * depth);
+        tm = tm >= m ? m : tm / MR * MR;
+        size_t tn = static_cast<size_t>((elements - 2. * static_cast<double>(tm) * depth)
+                                        / (2 * depth + static_cast<double>(tm)));
+        tn = tn >= n ? n : tn / NR * NR;
+        if ((m && !tm) || (n && !tn) || 2 * (tm * tk + tk * tn) + tm * tn > elements)
+            throw std::logic_error("memory budget is too small for a tile");
+
+        const Header header_c = make_header<K>(m, n, alignment);
+        const Descriptor file_c(out, O_WRONLY | O_CREAT | O_TRUNC);
+        write_header(file_c, header_c);
+
+        const size_t tiles_m = m ? (m + tm - 1) / tm : 0;
+        const size_t tiles_n = n ? (n + tn - 1) / tn : 0;
+        const size_t tiles_k = k ? (k + tk - 1) / tk : 1;
+        const size_t steps = tiles_m * tiles_n * tiles_k;
+        if (!steps)
+            return;
+
+        // Steps go through the result tiles column by column, the depth innermost.
+        // An operand tile needed by two steps in a row is only read once
+        struct Step
+        {
+            size_t i, j, p;     // Tile indices along m, n and k
+            size_t slot_a;      // Buffer holding the A tile
+            size_t slot_b;      // Buffer holding the B tile
+            bool read_a;        // Whether the A tile must be read
+            bool read_b;        // Whether the B tile must be read
+        };
+        const auto step_at = [&](const size_t& s, const Step * previous) {
+            Step step;
+            step.p = s % tiles_k;
+            step.i = s / tiles_k % tiles_m;
+            step.j = s / tiles_k / tiles_m;
+            step.read_a = !previous || previous->i != step.i || previous->p != step.p;
+            step.read_b = !previous || previous->j != step.j || previous->p != step.p;
+            step.slot_a = previous ? previous->slot_a ^ step.read_a : 0;
+            step.slot_b = previous ? previous->slot_b ^ step.read_b : 0;
+            return step;
+        };
+
+        Matrix<K> tiles_a[2] = { Matrix<K>(tm, tk), Matrix<K>(tm, tk) };
+        Matrix<K> tiles_b[2] = { Matrix<K>(tk, tn), Matrix<K>(tk, tn) };
+        Matrix<K> tile_c(tm, tn);
+
+        const auto load = [&](const Step& step) {
+            const size_t rows = std::min(tm, m - step.i * tm);
+            const size_t cols = std::min(tn, n - step.j * tn);
+            const size_t depth = std::min(tk, k - step.p * tk);
+            if (step.read_a)
+                read_block(file_a, header_a, step.i * tm, step.p * tk, rows, depth,
+                           tiles_a[step.slot_a].data(), tiles_a[step.slot_a].stride());
+            if (step.read_b)
+                read_block(file_b, header_b, step.p * tk, step.j * tn, depth, cols,
+                           tiles_b[step.slot_b].data(), tiles_b[step.slot_b].stride());
+        };
+
+        Step current = step_at(0, nullptr);
+        load(current);
+        for (size_t s = 0; s < steps; ++s)
+        {
+            std::future<void> pending;
+            Step next = current;
+            if (s + 1 < steps)
+            {
+                next = step_at(s + 1, &current);
+                pending = std::async(std::launch::async, load, next);
+            }
+
+            const size_t rows = std::min(tm, m - current.i * tm);
+            const size_t cols = std::min(tn, n - current.j * tn);
+            const size_t depth = std::min(tk, k - current.p * tk);
+            const Matrix<K>& a = tiles_a[current.slot_a];
+            const Matrix<K>& b = tiles_b[current.slot_b];
+            maths::gemm::multiply(rows, cols, depth, a.data(), a.stride(), b.data(), b.stride(),
+                                  tile_c.data(), tile_c.stride());
+
+            if (current.p + 1 == tiles_k)
+            {
+                for (size_t r = 0; r < rows; ++r)
+                    file_c.write(tile_c.data() + r * tile_c.stride(), cols * sizeof(K),
+                                 header_c.offset + ((current.i * tm + r) * n + current.j * tn) * sizeof(K));
+                tile_c.view().fill(K());
+            }
+
+            if (pending.valid())
+                pending.get();
+            current = next;
+        }
+    }
+}
+}
+
+#endif //MATRIXFILE_HPP
@@ -0,0 +1,374 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - MatrixView.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [10:50 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef MATRIXVIEW_HPP
+#define MATRIXVIEW_HPP
+
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "general.hpp"
+#include "simd.hpp"
+#include "gemm.hpp"
+#include "transpose.hpp"
+#include "Expression.hpp"
+#include "Matrix.hpp"
+#include "VectorView.hpp"
+
+/**
+ * Non-owning view over a block of a matrix, or of any row-major buffer,
+ * whose rows are `stride()` elements apart. Views take part in expressions
+ * and products like matrices, without copying what they refer to, and
+ * writing through them updates the viewed buffer
+ *
+ * A view is a handle: copying one refers to the same elements, while
+ * assigning to one writes into them. It must not outlive what it views,
+ * nor be assigned from a view overlapping it at another position
+ *
+ * @tparam K    Element type, `const` for read-only views
+ */
+template < class K >
+class MatrixView: public maths::expr::Expression<MatrixView<K>>
+{
+public:
+    using value_type = typename std::remove_const<K>::type;
+    using element_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using result_type = Matrix<value_type>;
+
+    MatrixView() = delete;
+    ~MatrixView() = default;
+
+    /**
+     * Constructs a view over a row-major buffer
+     *
+     * @param data                  First element
+     * @param height                Amount of rows
+     * @param width                 Amount of columns
+     * @param stride                Distance between two rows, at least the width
+     */
+    MatrixView(K * data, const size_type& height, const size_type& width, const size_type& stride) noexcept:
+        _data(data), _height(height), _width(width), _stride(stride) {}
+
+    /**
+     * Constructs a view over a whole matrix
+     *
+     * @param matrix                Viewed matrix
+     */
+    template < class A >
+    MatrixView(Matrix<value_type, A>& matrix) noexcept:
+        MatrixView(matrix.data(), matrix.height(), matrix.width(), matrix.stride()) {}
+
+    template < class A, class T = K, typename = typename std::enable_if<std::is_const<T>::value>::type >
+    MatrixView(const Matrix<value_type, A>& matrix) noexcept:
+        MatrixView(matrix.data(), matrix.height(), matrix.width(), matrix.stride()) {}
+
+    /**
+     * Constructs a read-only view from a writable one
+     */
+    template < class T, typename = typename
+        std::enable_if<std::is_same<const T, K>::value && !std::is_same<T, K>::value>::type >
+    MatrixView(const MatrixView<T>& other) noexcept:
+        MatrixView(other.data(), other.height(), other.width(), other.stride()) {}
+
+    MatrixView(const MatrixView& other) = default;
+
+    /**
+     * Writes the values of another operand of the same shape into the view
+     *
+     * @param rhs                   Matrix, view or expression to write
+     * @return                      This view
+     *
+     * @exception std::logic_error  Given operand is of different shape
+     */
+    MatrixView& operator=(const MatrixView& rhs)
+        { return this->_write(rhs, maths::expr::assign()); }
+
+    template < class T >
+    typename std::enable_if<maths::expr::is_operand<T>::value, MatrixView&>::type
+    operator=(const T& rhs)
+        { return this->_write(rhs, maths::expr::assign()); }
+
+    /**
+     * Adds another operand of the same shape to the viewed values
+     *
+     * @exception std::logic_error  Given operand is of different shape
+     */
+    template < class T >
+    typename std::enable_if<maths::expr::is_operand<T>::value, MatrixView&>::type
+    operator+=(const T& rhs)
+        { return this->_write(rhs, maths::expr::add_assign()); }
+
+    /**
+     * Subtracts another operand of the same shape from the viewed values
+     *
+     * @exception std::logic_error  Given operand is of different shape
+     */
+    template < class T >
+    typename std::enable_if<maths::expr::is_operand<T>::value, MatrixView&>::type
+    operator-=(const T& rhs)
+        { return this->_write(rhs, maths::expr::sub_assign()); }
+
+    /**
+     * Multiplies the viewed values by a scalar
+     *
+     * @param rhs                   Scalar value
+     * @return                      This view
+     */
+    MatrixView& operator*=(const value_type& rhs) noexcept
+    {
+        static_assert(!std::is_const<K>::value, "cannot write through a read-only view");
+        for (size_type m = 0; m < this->_height; ++m)
+            maths::simd::scale(this->_data + m * this->_stride, rhs, this->_width);
+        return *this;
+    }
+
+    /**
+     * Sets every viewed value to the given one
+     *
+     * @param value                 Value to fill with
+     */
+    void fill(const value_type& value)
+    {
+        static_assert(!std::is_const<K>::value, "cannot write through a read-only view");
+        for (size_type m = 0; m < this->_height; ++m)
+            std::fill(this->_data + m * this->_stride, this->_data + m * this->_stride + this->_width, value);
+    }
+
+    /**
+     * Retrieves the element at the given coordinates, with bounds checks
+     *
+     * @exception std::out_of_range Given coordinates points out of the view
+     */
+    K& at(const size_type& m, const size_type& n) const
+    {
+        if (!this->has(m, n))
+            throw std::out_of_range("position is out of range");
+        return this->_data[m * this->_stride + n];
+    }
+
+    /**
+     * Retrieves the element at the given coordinates
+     * (Caution: does not check for bounds)
+     */
+    K& operator[](const shape_type& pos) const noexcept
+        { return this->_data[pos.first * this->_stride + pos.second]; }
+
+    K& operator()(const size_type& m, const size_type& n) const noexcept
+        { return this->_data[m * this->_stride + n]; }
+
+    constexpr shape_type shape() const noexcept
+        { return { this->_height, this->_width }; }
+
+    constexpr size_type height() const noexcept
+        { return this->_height; }
+
+    constexpr size_type width() const noexcept
+        { return this->_width; }
+
+    constexpr size_type size() const noexcept
+        { return this->_height * this->_width; }
+
+    constexpr size_type stride() const noexcept
+        { return this->_stride; }
+
+    constexpr bool empty() const noexcept
+        { return !this->_height || !this->_width; }
+
+    constexpr bool square() const noexcept
+        { return this->_height == this->_width; }
+
+    constexpr bool has(const size_type& m, const size_type& n) const noexcept
+        { return m < this->_height && n < this->_width; }
+
+    K * data() const noexcept
+        { return this->_data; }
+
+    /**
+     * Views a block of the view
+     *
+     * @param m                     First row of the block
+     * @param n                     First column of the block
+     * @param height                Amount of rows
+     * @param width                 Amount of columns
+     * @return                      View over the block
+     *
+     * @exception std::out_of_range Block does not fit within the view
+     */
+    MatrixView block(const size_type& m, const size_type& n, const size_type& height, const size_type& width) const
+    {
+        if (m > this->_height || height > this->_height - m || n > this->_width || width > this->_width - n)
+            throw std::out_of_range("block is out of range");
+        return MatrixView(this->_data + m * this->_stride + n, height, width, this->_stride);
+    }
+
+    /**
+     * Views a row of the view
+     *
+     * @exception std::out_of_range Row does not exist
+     */
+    VectorView<K> row(const size_type& m) const
+    {
+        if (m >= this->_height)
+            throw std::out_of_range("position is out of range");
+        return VectorView<K>(this->_data + m * this->_stride, this->_width, 1);
+    }
+
+    /**
+     * Views a column of the view
+     *
+     * @exception std::out_of_range Column does not exist
+     */
+    VectorView<K> column(const size_type& n) const
+    {
+        if (n >= this->_width)
+            throw std::out_of_range("position is out of range");
+        return VectorView<K>(this->_data + n, this->_height, this->_stride);
+    }
+
+    /**
+     * Views the main diagonal of the view
+     */
+    VectorView<K> diagonal() const noexcept
+        { return VectorView<K>(this->_data, std::min(this->_height, this->_width), this->_stride + 1); }
+
+    /**
+     * Creates a transposed copy of the viewed values
+     *
+     * @return                      Transposed copy
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<value_type> transpose() const
+    {
+        Matrix<value_type> result(this->_width, this->_height);
+        maths::transpose::copy(this->_height, this->_width, static_cast<const value_type*>(this->_data),
+                               this->_stride, result.data(), result.stride());
+        return result;
+    }
+
+private:
+    /**
+     * Evaluates another operand into the view, element by element
+     *
+     * @exception std::logic_error  Given operand is of different shape
+     */
+    template < class T, class Op >
+    MatrixView& _write(const T& rhs, const Op& op)
+    {
+        static_assert(!std::is_const<K>::value, "cannot write through a read-only view");
+        const maths::expr::node<T> value(rhs);
+        if (value.height() != this->_height || value.width() != this->_width)
+            throw std::logic_error("cannot operate with different matrix sizes");
+        maths::expr::evaluate(value, this->_data, this->_stride, op);
+        return *this;
+    }
+
+    K *         _data;      // First viewed element
+    size_type   _height;    // Amount of rows
+    size_type   _width;     // Amount of columns
+    size_type   _stride;    // Distance between rows
+};
+
+namespace maths
+{
+namespace view
+{
+    /**
+     * Calculates the product of two matrix views through the GEMM engine,
+     * reading both operands in place
+     *
+     * @exception std::logic_error  Operands don't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    Matrix<K> multiply(const MatrixView<const K>& lhs, const MatrixView<const K>& rhs)
+    {
+        if (lhs.width() != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+        Matrix<K> result(lhs.height(), rhs.width());
+        maths::gemm::multiply(lhs.height(), rhs.width(), lhs.width(),
+                              lhs.data(), lhs.stride(),
+                              rhs.data(), rhs.stride(),
+                              result.data(), result.stride());
+        return result;
+    }
+
+    /**
+     * Calculates the product of a matrix view with a vector view
+     *
+     * @exception std::logic_error  Operands don't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    Vector<K> multiply(const MatrixView<const K>& lhs, const VectorView<const K>& rhs)
+    {
+        if (lhs.width() != rhs.size())
+            throw std::logic_error("incompatible for multiplication");
+        Vector<K> result(lhs.height());
+        for (size_t m = 0; m < lhs.height(); ++m)
+        {
+            K value = K();
+            for (size_t n = 0; n < lhs.width(); ++n)
+                value = maths::fma(lhs(m, n), rhs[n], value);
+            result[m] = value;
+        }
+        return result;
+    }
+}
+}
+
+/**
+ * Multiplies matrices and views together, without copying the views
+ *
+ * @exception std::logic_error  Operands don't match requirements
+ * @exception std::bad_alloc    Allocation failure
+ */
+template < class K, class T >
+Matrix<typename MatrixView<K>::value_type> operator*(const MatrixView<K>& lhs, const MatrixView<T>& rhs)
+    { return maths::view::multiply<typename MatrixView<K>::value_type>(lhs, rhs); }
+
+template < class K, class T, class A >
+Matrix<typename MatrixView<K>::value_type> operator*(const MatrixView<K>& lhs, const Matrix<T, A>& rhs)
+    { return maths::view::multiply<typename MatrixView<K>::value_type>(lhs, rhs); }
+
+template < class K, class A, class T >
+Matrix<K> operator*(const Matrix<K, A>& lhs, const MatrixView<T>& rhs)
+    { return maths::view::multiply<K>(lhs, rhs); }
+
+/**
+ * Multiplies matrices and views with vectors and vector views,
+ * without copying the views
+ *
+ * @exception std::logic_error  Operands don't match requirements
+ * @exception std::bad_alloc    Allocation failure
+ */
+template < class K, class T >
+Vector<typename MatrixView<K>::value_type> operator*(const MatrixView<K>& lhs, const VectorView<T>& rhs)
+    { return maths::view::multiply<typename MatrixView<K>::value_type>(lhs, rhs); }
+
+template < class K, class T, class A >
+Vector<typename MatrixView<K>::value_type> operator*(const MatrixView<K>& lhs, const Vector<T, A>& rhs)
+    { return maths::view::multiply<typename MatrixView<K>::value_type>(lhs, rhs); }
+
+template < class K, class A, class T >
+Vector<K> operator*(const Matrix<K, A>& lhs, const VectorView<T>& rhs)
+    { return maths::view::multiply<K>(lhs, rhs); }
+
+/**
+ * Writes the viewed values on the given output stream
+ */
+template < class K >
+std::ostream& operator<<(std::ostream& out, const MatrixView<K>& value)
+    { return out << Matrix<typename MatrixView<K>::value_type>(value); }
+
+#endif //MATRIXVIEW_HPP
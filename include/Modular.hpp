@@ -0,0 +1,301 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - Modular.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [12:10 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef MODULAR_HPP
+#define MODULAR_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include "general.hpp"
+#include "gemm.hpp"
+
+namespace maths
+{
+    /**
+     * Calculates the inverse of an odd number modulo 2^32, by Newton's
+     * iterations (each one doubling the amount of correct bits, odd numbers
+     * being their own inverse on 3 bits)
+     */
+    constexpr uint32_t inverse_of_odd(const uint32_t& value, const uint32_t& inverse, const int& steps) noexcept
+        { return steps ? inverse_of_odd(value, inverse * (2u - value * inverse), steps - 1) : inverse; }
+
+    constexpr uint32_t inverse_of_odd(const uint32_t& value) noexcept
+        { return inverse_of_odd(value, value, 4); }
+}
+
+/**
+ * Element of the prime field GF(P), the integers modulo P, usable as the
+ * value type of matrices and vectors: their rank, determinant and row
+ * echelon form then run an exact elimination (see maths::exact), and their
+ * products accumulate lazily, reducing once every few multiply-adds.
+ * Values are kept in Montgomery form (`x * 2^32 mod P`), so that products
+ * are reduced with multiplications and shifts only
+ *
+ * @tparam P        Modulus, an odd prime below 2^30
+ */
+template < uint32_t P >
+class Modular
+{
+    static_assert(P > 2 && P % 2 && P < (uint32_t(1) << 30), "modulus must be an odd prime below 2^30");
+
+public:
+    /**
+     * Constructs the zero element
+     */
+    constexpr Modular() noexcept: _value(0) {}
+
+    /**
+     * Constructs the element congruent to the given integer
+     *
+     * @param value                 Integer to reduce, negative ones included
+     */
+    template < class I, class = typename std::enable_if<std::is_integral<I>::value>::type >
+    Modular(const I& value) noexcept:
+        _value(Modular::redc(static_cast<uint64_t>(Modular::_residue(value, std::is_signed<I>())) * SQUARE))
+        {}
+
+    /**
+     * Retrieves the modulus of the field
+     *
+     * @return                      Modulus P
+     */
+    static constexpr uint32_t modulus() noexcept
+        { return P; }
+
+    /**
+     * Retrieves the canonical representative of the element, in [0, P)
+     *
+     * @return                      Integer value
+     */
+    uint32_t value() const noexcept
+        { return Modular::redc(this->_value); }
+
+    /**
+     * Retrieves the raw Montgomery form of the element, `value() * 2^32 mod P`,
+     * for kernels reducing on their own
+     *
+     * @return                      Montgomery form, in [0, P)
+     */
+    uint32_t montgomery() const noexcept
+        { return this->_value; }
+
+    /**
+     * Constructs an element from its raw Montgomery form
+     *
+     * @param value                 Montgomery form, in [0, P)
+     * @return                      Element
+     */
+    static Modular from_montgomery(const uint32_t& value) noexcept
+    {
+        Modular result;
+        result._value = value;
+        return result;
+    }
+
+    /**
+     * Montgomery reduction: calculates `value / 2^32 mod P`, in [0, P)
+     *
+     * @param value                 Value to reduce, below `P * 2^32`
+     * @return                      Reduced value
+     */
+    static uint32_t redc(const uint64_t& value) noexcept
+    {
+        const uint32_t factor = static_cast<uint32_t>(value) * NEGATED_INVERSE;
+        const uint32_t result = static_cast<uint32_t>((value + static_cast<uint64_t>(factor) * P) >> 32);
+        return result >= P ? result - P : result;
+    }
+
+    Modular& operator+=(const Modular& rhs) noexcept
+    {
+        this->_value += rhs._value;
+        if (this->_value >= P)
+            this->_value -= P;
+        return *this;
+    }
+
+    Modular& operator-=(const Modular& rhs) noexcept
+    {
+        this->_value = this->_value >= rhs._value ? this->_value - rhs._value : this->_value + P - rhs._value;
+        return *this;
+    }
+
+    Modular& operator*=(const Modular& rhs) noexcept
+    {
+        this->_value = Modular::redc(static_cast<uint64_t>(this->_value) * rhs._value);
+        return *this;
+    }
+
+    /**
+     * @exception std::domain_error Division by zero
+     */
+    Modular& operator/=(const Modular& rhs)
+        { return *this *= rhs.inverse(); }
+
+    Modular operator+(const Modular& rhs) const noexcept
+        { return Modular(*this) += rhs; }
+
+    Modular operator-(const Modular& rhs) const noexcept
+        { return Modular(*this) -= rhs; }
+
+    Modular operator*(const Modular& rhs) const noexcept
+        { return Modular(*this) *= rhs; }
+
+    /**
+     * @exception std::domain_error Division by zero
+     */
+    Modular operator/(const Modular& rhs) const
+        { return Modular(*this) /= rhs; }
+
+    Modular operator+() const noexcept
+        { return *this; }
+
+    Modular operator-() const noexcept
+        { return Modular::from_montgomery(this->_value ? P - this->_value : 0); }
+
+    bool operator==(const Modular& rhs) const noexcept
+        { return this->_value == rhs._value; }
+
+    bool operator!=(const Modular& rhs) const noexcept
+        { return this->_value != rhs._value; }
+
+    /**
+     * Raises the element to the given power, by squaring
+     *
+     * @param exponent              Power to raise to
+     * @return                      Element to the given power
+     */
+    Modular pow(uint64_t exponent) const noexcept
+    {
+        Modular result = Modular::from_montgomery(ONE);
+        Modular base = *this;
+        for (; exponent; exponent >>= 1, base *= base)
+            if (exponent & 1)
+                result *= base;
+        return result;
+    }
+
+    /**
+     * Calculates the multiplicative inverse of the element,
+     * as `x^(P - 2)` (Fermat's little theorem)
+     *
+     * @return                      Inverse
+     *
+     * @exception std::domain_error Element is zero
+     */
+    Modular inverse() const
+    {
+        if (!this->_value)
+            throw std::domain_error("zero has no inverse in a prime field");
+        return this->pow(P - 2);
+    }
+
+private:
+    // -P^-1 mod 2^32, cancelling the low half of products in redc()
+    static constexpr uint32_t NEGATED_INVERSE = 0u - maths::inverse_of_odd(P);
+
+    // 2^32 mod P, the Montgomery form of 1
+    static constexpr uint32_t ONE = static_cast<uint32_t>((uint64_t(1) << 32) % P);
+
+    // 2^64 mod P, converting integers into Montgomery form
+    static constexpr uint32_t SQUARE = static_cast<uint32_t>(uint64_t(ONE) * ONE % P);
+
+    template < class I >
+    static uint32_t _residue(const I& value, std::true_type) noexcept
+    {
+        const long long rest = static_cast<long long>(value) % static_cast<long long>(P);
+        return static_cast<uint32_t>(rest < 0 ? rest + P : rest);
+    }
+
+    template < class I >
+    static uint32_t _residue(const I& value, std::false_type) noexcept
+        { return static_cast<uint32_t>(static_cast<unsigned long long>(value) % P); }
+
+    uint32_t    _value; // Montgomery form, in [0, P)
+};
+
+template < uint32_t P >
+constexpr uint32_t Modular<P>::NEGATED_INVERSE;
+
+template < uint32_t P >
+constexpr uint32_t Modular<P>::ONE;
+
+template < uint32_t P >
+constexpr uint32_t Modular<P>::SQUARE;
+
+template < uint32_t P >
+std::ostream& operator<<(std::ostream& os, const Modular<P>& value)
+    { return os << value.value(); }
+
+namespace maths
+{
+    template < uint32_t P >
+    struct elimination_of<Modular<P>>
+        { using type = elimination::exact; };
+
+namespace gemm
+{
+    template < uint32_t P >
+    struct blocking<Modular<P>>
+    {
+        static constexpr size_t MR = 4;
+        static constexpr size_t NR = 8;
+        static constexpr size_t KC = 256;
+        static constexpr size_t MC = 64;
+        static constexpr size_t NC = 1024;
+    };
+
+    /**
+     * Lazy micro-kernel of modular products: Montgomery forms are multiplied
+     * into 64-bit sums, only folded modulo P once they could overflow, and
+     * reduced once per tile
+     */
+    template < uint32_t P >
+    struct portable_kernel<Modular<P>>
+    {
+        // Amount of products summed between two folds, on top of a value below P
+        static constexpr size_t FOLD = (std::numeric_limits<uint64_t>::max() - P)
+                                     / (static_cast<uint64_t>(P - 1) * (P - 1));
+
+        static void run(const size_t& kc, const Modular<P>* a, const Modular<P>* b, Modular<P>* c,
+                        const size_t& ldc)
+        {
+            constexpr size_t MR = blocking<Modular<P>>::MR;
+            constexpr size_t NR = blocking<Modular<P>>::NR;
+
+            uint64_t acc[MR][NR] = {};
+            for (size_t p = 0; p < kc;)
+            {
+                const size_t last = kc - p < FOLD ? kc : p + FOLD;
+                for (; p < last; ++p, a += MR, b += NR)
+                    for (size_t i = 0; i < MR; ++i)
+                    {
+                        const uint64_t value = a[i].montgomery();
+                        for (size_t j = 0; j < NR; ++j)
+                            acc[i][j] += value * b[j].montgomery();
+                    }
+                for (size_t i = 0; i < MR; ++i)
+                    for (size_t j = 0; j < NR; ++j)
+                        acc[i][j] %= P;
+            }
+
+            for (size_t i = 0; i < MR; ++i)
+                for (size_t j = 0; j < NR; ++j)
+                    c[i * ldc + j] += Modular<P>::from_montgomery(Modular<P>::redc(acc[i][j]));
+        }
+    };
+}
+}
+
+#endif //MODULAR_HPP
@@ -0,0 +1,621 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - QR.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [9:45 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef QR_HPP
+#define QR_HPP
+
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include "general.hpp"
+#include "gemm.hpp"
+#include "blas.hpp"
+#include "Arena.hpp"
+#include "ThreadPool.hpp"
+#include "Matrix.hpp"
+
+/**
+ * QR factorization with column pivoting, denoted `AP = QR`, of a matrix of any
+ * shape. Columns are chosen by decreasing remaining norm, so that the diagonal
+ * of R decreases and reveals the numerical rank of A. R is stored on and above
+ * the diagonal of the factors, and Q as a product of Householder reflectors
+ * `H(k) = I - tau(k) v(k) v(k)'`, whose vectors are stored below the diagonal
+ * (with an implicit leading 1)
+ *
+ * @tparam K        Matrix inner working type (floating point)
+ * @tparam Alloc    Allocator of the factors, scalars and permutation
+ */
+template < class K, class Alloc >
+class QR
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using allocator_type = Alloc;
+    using scalars_type = std::vector<value_type,
+        typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>>;
+    using permutation_type = std::vector<size_type,
+        typename std::allocator_traits<Alloc>::template rebind_alloc<size_type>>;
+
+    // Width of the panels factorized before updating the trailing matrix
+    static constexpr size_type BLOCK = 32;
+
+    // Amount of multiply-adds under which a panel step stays on a single thread
+    static constexpr size_type PARALLEL_THRESHOLD = 256 * 1024;
+
+    QR() = delete;
+    ~QR() = default;
+
+    /**
+     * Factorizes the given matrix
+     *
+     * @param matrix                Matrix to factorize
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit QR(const Matrix<K, Alloc>& matrix):
+        _factors(matrix), _tau(std::min(matrix.height(), matrix.width())), _permutation(matrix.width())
+        { this->_factorize(); }
+
+    /**
+     * Factorizes the given matrix, converting its values into K
+     * (e.g. for working in a wider type)
+     *
+     * @param matrix                Matrix to factorize
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class T, class A >
+    explicit QR(const Matrix<T, A>& matrix):
+        _factors(matrix.height(), matrix.width()), _tau(std::min(matrix.height(), matrix.width())),
+        _permutation(matrix.width())
+    {
+        for (size_type m = 0; m < matrix.height(); ++m)
+            for (size_type n = 0; n < matrix.width(); ++n)
+                this->_factors[{m, n}] = static_cast<K>(matrix[{m, n}]);
+        this->_factorize();
+    }
+
+    /**
+     * Retrieves the packed factors, R on and above the diagonal
+     * and the Householder vectors below
+     *
+     * @return                      Packed factors
+     */
+    const Matrix<K, Alloc>& factors() const noexcept
+        { return this->_factors; }
+
+    /**
+     * Retrieves the scalars of the Householder reflectors
+     *
+     * @return                      Reflector scalars, one per diagonal element
+     */
+    const scalars_type& tau() const noexcept
+        { return this->_tau; }
+
+    /**
+     * Retrieves the column permutation: column `j` of AP is column
+     * `permutation()[j]` of A
+     *
+     * @return                      Column indices
+     */
+    const permutation_type& permutation() const noexcept
+        { return this->_permutation; }
+
+    /**
+     * Retrieves the height of the factorized matrix
+     *
+     * @return                      Matrix height
+     */
+    size_type height() const noexcept
+        { return this->_factors.height(); }
+
+    /**
+     * Retrieves the width of the factorized matrix
+     *
+     * @return                      Matrix width
+     */
+    size_type width() const noexcept
+        { return this->_factors.width(); }
+
+    /**
+     * Retrieves the default relative tolerance of rank(), covering the
+     * rounding errors of the factorization: `max(m, n) * epsilon`
+     *
+     * @return                      Default tolerance
+     */
+    value_type tolerance() const noexcept
+    {
+        return static_cast<value_type>(std::max(this->height(), this->width()))
+             * std::numeric_limits<value_type>::epsilon();
+    }
+
+    /**
+     * Calculates the numerical rank of the factorized matrix, as the amount
+     * of leading diagonal elements of R above `tolerance * |R(0, 0)|`
+     *
+     * @param tolerance             Relative magnitude under which R is negligible
+     * @return                      Rank of the factorized matrix
+     */
+    size_type rank(const value_type& tolerance) const
+    {
+        const size_type count = this->_tau.size();
+        if (!count)
+            return 0;
+        const value_type limit = tolerance * std::abs(this->_factors[{0, 0}]);
+        size_type rank = 0;
+        while (rank < count && std::abs(this->_factors[{rank, rank}]) > limit)
+            ++rank;
+        return rank;
+    }
+
+    size_type rank() const
+        { return this->rank(this->tolerance()); }
+
+    /**
+     * Extracts the upper triangular factor R, of `min(m, n)` rows
+     *
+     * @return                      Factor R
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K, Alloc> r() const
+    {
+        Matrix<K, Alloc> result(this->_tau.size(), this->width());
+        for (size_type m = 0; m < result.height(); ++m)
+            for (size_type n = m; n < result.width(); ++n)
+                result[{m, n}] = this->_factors[{m, n}];
+        return result;
+    }
+
+    /**
+     * Forms the thin orthogonal factor Q, of `min(m, n)` orthonormal columns,
+     * by applying the reflectors on the leading columns of the identity
+     *
+     * @return                      Factor Q
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K, Alloc> q() const
+    {
+        const size_type count = this->_tau.size();
+        Matrix<K, Alloc> result(this->height(), count);
+        for (size_type i = 0; i < count; ++i)
+            result[{i, i}] = value_type(1);
+        for (size_type k = count; k--;)
+            this->_reflect(k, result.data(), count, result.stride());
+        return result;
+    }
+
+    /**
+     * Applies the transpose of Q onto every column of B, overwriting B
+     *
+     * @param rhs                   Columns to transform, of the matrix' height
+     *
+     * @exception std::logic_error  Columns are not of the matrix' height
+     */
+    template < class A >
+    void apply_qt(Matrix<K, A>& rhs) const
+        { this->apply_qt(rhs.view()); }
+
+    void apply_qt(const MatrixView<K>& rhs) const
+    {
+        if (rhs.height() != this->height())
+            throw std::logic_error("cannot apply with different matrix heights");
+        for (size_type k = 0; k < this->_tau.size() && !rhs.empty(); ++k)
+            this->_reflect(k, rhs.data(), rhs.width(), rhs.stride());
+    }
+
+    /**
+     * Solves the least-squares problem `min |AX - B|` for every column of B,
+     * in the basic sense for rank-deficient matrices: only the leading rank()
+     * columns of AP are used, the other unknowns being left to zero
+     *
+     * @param rhs                   Right-hand sides, one per column
+     * @return                      Solutions, one per column, of the matrix' width
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    Matrix<K, A> solve(const Matrix<K, A>& rhs) const
+    {
+        if (rhs.height() != this->height())
+            throw std::logic_error("cannot solve with different matrix heights");
+        Matrix<K, A> work = rhs;
+        Matrix<K, A> result(this->width(), rhs.width());
+        if (!rhs.empty())
+            this->_least_squares(work.data(), rhs.width(), work.stride(), result.data(), result.stride());
+        return result;
+    }
+
+    /**
+     * Solves the least-squares problem `min |Ax - b|`, in the basic sense
+     * for rank-deficient matrices (see solve() for matrices)
+     *
+     * @param rhs                   Right-hand side
+     * @return                      Solution, of the matrix' width
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    Vector<K, A> solve(const Vector<K, A>& rhs) const
+    {
+        if (rhs.size() != this->height())
+            throw std::logic_error("cannot solve with different matrix heights");
+        Vector<K, A> work = rhs;
+        Vector<K, A> result(this->width());
+        this->_least_squares(work.view().data(), 1, work.view().step(),
+                             result.view().data(), result.view().step());
+        return result;
+    }
+
+private:
+    /**
+     * Runs `body(first, last)` over ranges of the given amount of columns,
+     * in parallel on the shared thread pool when there are enough multiply-adds
+     */
+    template < class F >
+    static void _for_columns(const size_type& height, const size_type& width, const F& body)
+    {
+        maths::ThreadPool& pool = maths::ThreadPool::global();
+        if (pool.size() == 1 || height * width < PARALLEL_THRESHOLD)
+            return body(size_type(0), width);
+        const size_type chunk = std::max<size_type>(64, width / pool.size() + 1);
+        pool.parallel_for((width + chunk - 1) / chunk, [&](const size_type& c) {
+            body(c * chunk, std::min(width, (c + 1) * chunk));
+        });
+    }
+
+    /**
+     * Calculates the euclidean norm of a column, over rows [first, height)
+     */
+    value_type _norm(const size_type& first, const size_type& column) const
+    {
+        const size_type rows = this->height() - first;
+        if (!rows)
+            return value_type();
+        return static_cast<value_type>(maths::blas::nrm2(rows, &this->_factors[{first, column}],
+                                                         this->_factors.stride()));
+    }
+
+    /**
+     * Blocked factorization with column pivoting (as LAPACK's xGEQP3): panels
+     * of columns are factorized one reflector at a time, with the pivoting
+     * norms kept up to date, while the updates of the trailing matrix are
+     * gathered into `F`, so that they are applied at once through the GEMM engine
+     */
+    void _factorize()
+    {
+        const size_type m = this->height();
+        const size_type n = this->width();
+        std::iota(this->_permutation.begin(), this->_permutation.end(), size_type(0));
+        const size_type count = this->_tau.size();
+        if (!count)
+            return;
+
+        // Partial and original norms of the remaining part of every column
+        maths::Scratch<value_type> partial(n), original(n);
+        for (size_type j = 0; j < n; ++j)
+            partial[j] = original[j] = this->_norm(0, j);
+        maths::Scratch<value_type> f(BLOCK * n);
+        std::vector<size_type> stale;
+
+        for (size_type p = 0; p < count;)
+        {
+            const size_type nb = count - p < BLOCK ? count - p : BLOCK;
+            const size_type kb = this->_factorize_panel(p, nb, partial.get(), original.get(), f.get(), stale);
+            const size_type done = p + kb;
+            const size_type ldf = n - p;
+
+            // A22 -= V2 * F', with F kept transposed
+            if (done < m && done < n)
+            {
+                value_type * a = this->_factors.data();
+                const size_type lda = this->_factors.stride();
+                for (size_type l = 0; l < kb; ++l)
+                    for (size_type j = kb; j < ldf; ++j)
+                        f[l * ldf + j] = -f[l * ldf + j];
+                maths::gemm::multiply(m - done, n - done, kb,
+                                      a + done * lda + p, lda,
+                                      f.get() + kb, ldf,
+                                      a + done * lda + done, lda);
+            }
+
+            // Norms which lost too much accuracy while downdated
+            for (size_type j : stale)
+                partial[j] = original[j] = this->_norm(done, j);
+            stale.clear();
+            p = done;
+        }
+    }
+
+    /**
+     * Factorizes at most nb columns from column p, stopping early once a norm
+     * needs to be calculated again. Rows of the panel are brought up to date,
+     * while `F' = T' V' A` is stored in `f`, nb rows of `n - p` columns
+     *
+     * @return                      Amount of factorized columns
+     */
+    size_type _factorize_panel(const size_type& p, const size_type& nb, value_type * partial,
+                               value_type * original, value_type * f, std::vector<size_type>& stale)
+    {
+        const size_type m = this->height();
+        const size_type n = this->width();
+        const size_type ldf = n - p;
+        const size_type lda = this->_factors.stride();
+        value_type * a = this->_factors.data();
+        const value_type threshold = std::sqrt(std::numeric_limits<value_type>::epsilon());
+        maths::Scratch<value_type> g(ldf);
+
+        size_type k = 0;
+        while (k < nb && stale.empty())
+        {
+            const size_type c = p + k;
+
+            // Largest remaining column first
+            const size_type pivot = c + maths::blas::iamax(n - c, partial + c, 1);
+            if (pivot != c)
+            {
+                this->_factors.swap_columns(c, pivot);
+                for (size_type l = 0; l < k; ++l)
+                    std::swap(f[l * ldf + c - p], f[l * ldf + pivot - p]);
+                std::swap(this->_permutation[c], this->_permutation[pivot]);
+                partial[pivot] = partial[c];
+                original[pivot] = original[c];
+            }
+
+            // Brings the column up to date with the previous reflectors of the panel
+            for (size_type i = c; i < m; ++i)
+            {
+                value_type sum = value_type();
+                for (size_type l = 0; l < k; ++l)
+                    sum += a[i * lda + p + l] * f[l * ldf + c - p];
+                a[i * lda + c] -= sum;
+            }
+
+            const value_type tau = this->_reflector(c);
+            this->_tau[c] = tau;
+            const value_type diagonal = a[c * lda + c];
+            a[c * lda + c] = value_type(1);
+
+            // F(k) = tau * A' v - tau * F * (V' v), over every column of the panel onwards
+            value_type * row = f + k * ldf;
+            if (tau == value_type())
+                std::fill(row, row + ldf, value_type());
+            else
+            {
+                _for_columns(m - c, ldf, [&](const size_type& first, const size_type& last) {
+                    this->_gather(c, p + first, last - first, g.get() + first);
+                });
+                for (size_type j = 0; j < ldf; ++j)
+                    row[j] = j > k ? tau * g[j] : value_type();
+                for (size_type l = 0; l < k; ++l)
+                {
+                    const value_type factor = -tau * g[l];
+                    if (factor == value_type())
+                        continue;
+                    const value_type * previous = f + l * ldf;
+                    for (size_type j = 0; j < ldf; ++j)
+                        row[j] += factor * previous[j];
+                }
+            }
+
+            // Brings the pivot row up to date with every reflector of the panel
+            for (size_type j = c + 1; j < n; ++j)
+            {
+                value_type sum = value_type();
+                for (size_type l = 0; l <= k; ++l)
+                    sum += a[c * lda + p + l] * f[l * ldf + j - p];
+                a[c * lda + j] -= sum;
+            }
+
+            // Downdates the norms, removing the pivot row from them
+            for (size_type j = c + 1; j < n; ++j)
+            {
+                if (partial[j] == value_type())
+                    continue;
+                const value_type ratio = std::abs(a[c * lda + j]) / partial[j];
+                const value_type left = std::max(value_type(), (1 + ratio) * (1 - ratio));
+                const value_type drift = partial[j] / original[j];
+                if (left * drift * drift <= threshold)
+                    stale.push_back(j);
+                else
+                    partial[j] *= std::sqrt(left);
+            }
+
+            a[c * lda + c] = diagonal;
+            ++k;
+        }
+        return k;
+    }
+
+    /**
+     * Calculates `A' v` over the given columns, for the reflector stored in column c
+     * (with its leading 1 in place), four rows at a time and by blocks of columns
+     * that stay in cache
+     *
+     * @param c                     Column of the reflector
+     * @param first                 First column to calculate
+     * @param count                 Amount of columns to calculate
+     * @param g                     Results, one per column
+     */
+    void _gather(const size_type& c, const size_type& first, const size_type& count, value_type * g) const
+    {
+        constexpr size_type SPAN = 512;
+        const size_type m = this->height();
+        const size_type lda = this->_factors.stride();
+        const value_type * a = this->_factors.data();
+
+        for (size_type start = 0; start < count; start += SPAN)
+        {
+            const size_type span = count - start < SPAN ? count - start : SPAN;
+            value_type * sums = g + start;
+            std::fill(sums, sums + span, value_type());
+            size_type i = c;
+            for (; i + 4 <= m; i += 4)
+            {
+                const value_type * r0 = a + i * lda + first + start;
+                const value_type * r1 = r0 + lda;
+                const value_type * r2 = r1 + lda;
+                const value_type * r3 = r2 + lda;
+                const value_type v0 = a[i * lda + c], v1 = a[(i + 1) * lda + c];
+                const value_type v2 = a[(i + 2) * lda + c], v3 = a[(i + 3) * lda + c];
+                for (size_type j = 0; j < span; ++j)
+                    sums[j] += v0 * r0[j] + v1 * r1[j] + v2 * r2[j] + v3 * r3[j];
+            }
+            for (; i < m; ++i)
+            {
+                const value_type * r0 = a + i * lda + first + start;
+                const value_type v0 = a[i * lda + c];
+                for (size_type j = 0; j < span; ++j)
+                    sums[j] += v0 * r0[j];
+            }
+        }
+    }
+
+    /**
+     * Generates the reflector annihilating column c below the diagonal:
+     * the diagonal becomes `beta`, the rows below the vector v
+     *
+     * @return                      Reflector scalar, 0 if the column is zero already
+     */
+    value_type _reflector(const size_type& c)
+    {
+        const size_type m = this->height();
+        const size_type lda = this->_factors.stride();
+        value_type * a = this->_factors.data();
+        const value_type alpha = a[c * lda + c];
+        const value_type norm = this->_norm(c + 1, c);
+        if (norm == value_type())
+            return value_type();
+
+        const value_type beta = -std::copysign(std::hypot(alpha, norm), alpha);
+        const value_type scale = value_type(1) / (alpha - beta);
+        for (size_type i = c + 1; i < m; ++i)
+            a[i * lda + c] *= scale;
+        a[c * lda + c] = beta;
+        return (beta - alpha) / beta;
+    }
+
+    /**
+     * Applies the reflector k onto a row-major block of the matrix' height
+     *
+     * @param b                     Block to transform
+     * @param width                 Amount of columns of the block
+     * @param ldb                   Distance between two rows of `b`
+     */
+    void _reflect(const size_type& k, value_type * b, const size_type& width, const size_type& ldb) const
+    {
+        const value_type tau = this->_tau[k];
+        if (tau == value_type())
+            return;
+        const size_type m = this->height();
+        const size_type lda = this->_factors.stride();
+        const value_type * a = this->_factors.data();
+
+        maths::Scratch<value_type> w(width);
+        for (size_type j = 0; j < width; ++j)
+            w[j] = b[k * ldb + j];
+        for (size_type i = k + 1; i < m; ++i)
+        {
+            const value_type v = a[i * lda + k];
+            for (size_type j = 0; j < width; ++j)
+                w[j] += v * b[i * ldb + j];
+        }
+        for (size_type j = 0; j < width; ++j)
+        {
+            w[j] *= tau;
+            b[k * ldb + j] -= w[j];
+        }
+        for (size_type i = k + 1; i < m; ++i)
+        {
+            const value_type v = a[i * lda + k];
+            for (size_type j = 0; j < width; ++j)
+                b[i * ldb + j] -= v * w[j];
+        }
+    }
+
+    /**
+     * Calculates the basic least-squares solutions: `Q'B` overwrites B, then
+     * the leading rank() rows are solved against R, and the unknowns are
+     * written back into their original order
+     *
+     * @param b                     Right-hand sides, of the matrix' height
+     * @param width                 Amount of right-hand sides
+     * @param ldb                   Distance between two rows of `b`
+     * @param x                     Solutions, of the matrix' width
+     * @param ldx                   Distance between two rows of `x`
+     */
+    void _least_squares(value_type * b, const size_type& width, const size_type& ldb,
+                        value_type * x, const size_type& ldx) const
+    {
+        for (size_type k = 0; k < this->_tau.size(); ++k)
+            this->_reflect(k, b, width, ldb);
+
+        const size_type rank = this->rank();
+        const size_type lda = this->_factors.stride();
+        const value_type * a = this->_factors.data();
+        for (size_type i = rank; i--;)
+        {
+            value_type * row = b + i * ldb;
+            for (size_type p = i + 1; p < rank; ++p)
+            {
+                const value_type factor = a[i * lda + p];
+                for (size_type c = 0; c < width; ++c)
+                    row[c] -= factor * b[p * ldb + c];
+            }
+            const value_type diagonal = a[i * lda + i];
+            for (size_type c = 0; c < width; ++c)
+                row[c] /= diagonal;
+        }
+
+        for (size_type j = 0; j < this->width(); ++j)
+        {
+            value_type * target = x + this->_permutation[j] * ldx;
+            for (size_type c = 0; c < width; ++c)
+                target[c] = j < rank ? b[j * ldb + c] : value_type();
+        }
+    }
+
+    Matrix<K, Alloc>        _factors;       // Packed R and Householder vectors
+    scalars_type            _tau;           // Scalars of the Householder reflectors
+    permutation_type        _permutation;   // Column order of AP
+};
+
+/**
+ * Solves the least-squares problem `min |AX - B|` through a QR factorization
+ * with column pivoting, for tall (or rank-deficient) systems. For solving
+ * many systems against the same matrix, prefer keeping `A.qr()`
+ *
+ * @exception std::logic_error  B is not of A's height
+ * @exception std::bad_alloc    Allocation failure
+ */
+template < class K, class A, class B >
+Matrix<K, B> lstsq(const Matrix<K, A>& a, const Matrix<K, B>& b)
+    { return a.qr().solve(b); }
+
+/**
+ * Solves the least-squares problem `min |Ax - b|`
+ *
+ * @exception std::logic_error  b is not of A's height
+ * @exception std::bad_alloc    Allocation failure
+ */
+template < class K, class A, class B >
+Vector<K, B> lstsq(const Matrix<K, A>& a, const Vector<K, B>& b)
+    { return a.qr().solve(b); }
+
+#endif //QR_HPP
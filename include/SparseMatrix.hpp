@@ -0,0 +1,656 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - SparseMatrix.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [2:30 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef SPARSEMATRIX_HPP
+#define SPARSEMATRIX_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+#include "general.hpp"
+#include "ThreadPool.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+namespace maths
+{
+namespace sparse
+{
+    // Amount of stored values under which products stay on a single thread
+    constexpr size_t PARALLEL_THRESHOLD = 64 * 1024;
+
+    /**
+     * Direction along which the values of a sparse matrix are compressed
+     */
+    enum class Order
+    {
+        row,    // Compressed Sparse Row (CSR): fast rows, products with a matrix on the right
+        column  // Compressed Sparse Column (CSC): fast columns
+    };
+
+    /**
+     * Compressed storage: the values of major line `i` (a row in CSR, a column
+     * in CSC) are `values[offsets[i]..offsets[i + 1])`, at minor positions
+     * `indices[...]`, sorted in increasing order without duplicates
+     */
+    template < class K >
+    struct Compressed
+    {
+        std::vector<size_t> offsets;
+        std::vector<size_t> indices;
+        std::vector<K>      values;
+    };
+
+    /**
+     * Swaps the compression direction of a storage (turns a CSR matrix into
+     * the CSC of the same matrix, or the opposite), by counting sort
+     *
+     * @param from                  Storage to convert
+     * @param minor                 Size along the minor direction of `from`
+     * @return                      Converted storage
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    Compressed<K> transpose(const Compressed<K>& from, const size_t& minor)
+    {
+        const size_t major = from.offsets.size() - 1;
+        Compressed<K> result;
+        result.offsets.assign(minor + 1, 0);
+        result.indices.resize(from.indices.size());
+        result.values.resize(from.values.size());
+
+        for (const size_t& index : from.indices)
+            ++result.offsets[index + 1];
+        for (size_t i = 0; i < minor; ++i)
+            result.offsets[i + 1] += result.offsets[i];
+
+        std::vector<size_t> next(result.offsets.begin(), result.offsets.end() - 1);
+        for (size_t i = 0; i < major; ++i)
+            for (size_t e = from.offsets[i]; e < from.offsets[i + 1]; ++e)
+            {
+                const size_t position = next[from.indices[e]]++;
+                result.indices[position] = i;
+                result.values[position] = from.values[e];
+            }
+        return result;
+    }
+
+    /**
+     * Multiplies two storages compressed the same way, row by row
+     * (Gustavson's algorithm): the result is compressed that way too.
+     * Lines of the result are accumulated in a dense scratch line
+     *
+     * @param lhs                   Left operand, as CSR
+     * @param rhs                   Right operand, as CSR
+     * @param width                 Width of the right operand
+     * @return                      Product, as CSR
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    Compressed<K> multiply(const Compressed<K>& lhs, const Compressed<K>& rhs, const size_t& width)
+    {
+        const size_t height = lhs.offsets.size() - 1;
+        Compressed<K> result;
+        result.offsets.reserve(height + 1);
+        result.offsets.push_back(0);
+
+        std::vector<K> line(width);
+        std::vector<size_t> seen(width, height);
+        std::vector<size_t> touched;
+        for (size_t i = 0; i < height; ++i)
+        {
+            for (size_t e = lhs.offsets[i]; e < lhs.offsets[i + 1]; ++e)
+            {
+                const K& value = lhs.values[e];
+                const size_t k = lhs.indices[e];
+                for (size_t f = rhs.offsets[k]; f < rhs.offsets[k + 1]; ++f)
+                {
+                    const size_t j = rhs.indices[f];
+                    if (seen[j] != i)
+                    {
+                        seen[j] = i;
+                        line[j] = K();
+                        touched.push_back(j);
+                    }
+                    line[j] = maths::fma(value, rhs.values[f], line[j]);
+                }
+            }
+            std::sort(touched.begin(), touched.end());
+            for (const size_t& j : touched)
+            {
+                result.indices.push_back(j);
+                result.values.push_back(line[j]);
+            }
+            result.offsets.push_back(result.indices.size());
+            touched.clear();
+        }
+        return result;
+    }
+
+    /**
+     * Runs `body(first, last)` over ranges of major lines holding about as many
+     * values each, in parallel on the shared thread pool for large storages
+     *
+     * @param offsets               Offsets of the storage
+     * @param body                  Function to run on each range
+     */
+    template < class F >
+    void for_lines(const std::vector<size_t>& offsets, const F& body)
+    {
+        const size_t lines = offsets.size() - 1;
+        const size_t values = offsets.back();
+        ThreadPool& pool = ThreadPool::global();
+        if (pool.size() == 1 || values < PARALLEL_THRESHOLD || lines < 2)
+            return body(size_t(0), lines);
+
+        const size_t chunks = std::min(lines, pool.size() * 4);
+        pool.parallel_for(chunks, [&](const size_t& chunk) {
+            const auto line_at = [&](const size_t& c) {
+                if (!c || c == chunks)
+                    return c ? lines : size_t(0);
+                const size_t target = values / chunks * c + values % chunks * c / chunks;
+                return static_cast<size_t>(std::upper_bound(offsets.begin(), offsets.end(), target)
+                                           - offsets.begin() - 1);
+            };
+            const size_t first = line_at(chunk);
+            const size_t last = line_at(chunk + 1);
+            if (first < last)
+                body(first, last);
+        });
+    }
+}
+}
+
+template < class K >
+class SparseBuilder;
+
+/**
+ * Sparse matrix, storing its non-zero values only, compressed by rows (CSR)
+ * or by columns (CSC). Built from coordinates (see SparseBuilder) or from
+ * a dense matrix, it multiplies with vectors, dense matrices and other
+ * sparse matrices
+ *
+ * @tparam K        Matrix inner working type
+ * @tparam O        Compression direction (see maths::sparse::Order)
+ */
+template < class K, maths::sparse::Order O = maths::sparse::Order::row >
+class SparseMatrix
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using storage_type = maths::sparse::Compressed<K>;
+
+    static constexpr bool row_major = O == maths::sparse::Order::row;
+
+    /**
+     * Constructs a new matrix of given size, without any value
+     *
+     * @param height                Height of the matrix (usually denoted `m`)
+     * @param width                 Width of the matrix (usually denoted `n`)
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    SparseMatrix(const size_type& height, const size_type& width):
+        _max_m(height), _max_n(width), _storage()
+        { this->_storage.offsets.assign((row_major ? height : width) + 1, 0); }
+
+    /**
+     * Constructs a new matrix from the coordinates gathered by a builder
+     *
+     * @param builder               Builder holding the values
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit SparseMatrix(const SparseBuilder<K>& builder);
+
+    /**
+     * Constructs a new matrix from the non-zero values of a dense matrix
+     *
+     * @param other                 Dense matrix to compress
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    explicit SparseMatrix(const Matrix<K, A>& other):
+        SparseMatrix(other.height(), other.width())
+    {
+        const size_type major = row_major ? this->_max_m : this->_max_n;
+        const size_type minor = row_major ? this->_max_n : this->_max_m;
+        for (size_type i = 0; i < major; ++i)
+        {
+            for (size_type j = 0; j < minor; ++j)
+            {
+                const K& value = row_major ? other[{ i, j }] : other[{ j, i }];
+                if (value != K())
+                {
+                    this->_storage.indices.push_back(j);
+                    this->_storage.values.push_back(value);
+                }
+            }
+            this->_storage.offsets[i + 1] = this->_storage.indices.size();
+        }
+    }
+
+    /**
+     * Constructs a new matrix from the same matrix compressed the other way
+     * (CSR from CSC, or the opposite)
+     *
+     * @param other                 Matrix to convert
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < maths::sparse::Order P, typename = typename std::enable_if<P != O>::type >
+    explicit SparseMatrix(const SparseMatrix<K, P>& other):
+        _max_m(other.height()), _max_n(other.width()),
+        _storage(maths::sparse::transpose(other.storage(), row_major ? other.height() : other.width())) {}
+
+    /**
+     * Constructs a new matrix over compressed storage, without checking it
+     *
+     * @param height                Height of the matrix
+     * @param width                 Width of the matrix
+     * @param storage               Compressed values, along the matrix order
+     */
+    SparseMatrix(const size_type& height, const size_type& width, storage_type&& storage) noexcept:
+        _max_m(height), _max_n(width), _storage(std::move(storage)) {}
+
+    SparseMatrix(const SparseMatrix& other) = default;
+    SparseMatrix(SparseMatrix&& other) noexcept = default;
+    SparseMatrix& operator=(const SparseMatrix& rhs) = default;
+    SparseMatrix& operator=(SparseMatrix&& rhs) noexcept = default;
+    ~SparseMatrix() = default;
+
+    /**
+     * Checks if both matrices store the same values at the same positions
+     */
+    bool operator==(const SparseMatrix& rhs) const
+    {
+        return this->shape() == rhs.shape() && this->_storage.offsets == rhs._storage.offsets
+            && this->_storage.indices == rhs._storage.indices && this->_storage.values == rhs._storage.values;
+    }
+
+    bool operator!=(const SparseMatrix& rhs) const
+        { return !(*this == rhs); }
+
+    /**
+     * Retrieves the value at the given position, zero when none is stored
+     *
+     * @param m                     Row of the value
+     * @param n                     Column of the value
+     * @return                      Value at the position
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    value_type at(const size_type& m, const size_type& n) const
+    {
+        if (m >= this->_max_m || n >= this->_max_n)
+            throw std::out_of_range("position is out of range");
+        const size_type major = row_major ? m : n;
+        const size_type minor = row_major ? n : m;
+        const auto first = this->_storage.indices.begin() + this->_storage.offsets[major];
+        const auto last = this->_storage.indices.begin() + this->_storage.offsets[major + 1];
+        const auto found = std::lower_bound(first, last, minor);
+        if (found == last || *found != minor)
+            return K();
+        return this->_storage.values[found - this->_storage.indices.begin()];
+    }
+
+    constexpr shape_type shape() const noexcept
+        { return { this->_max_m, this->_max_n }; }
+
+    constexpr size_type height() const noexcept
+        { return this->_max_m; }
+
+    constexpr size_type width() const noexcept
+        { return this->_max_n; }
+
+    /**
+     * Retrieves the amount of stored values
+     */
+    size_type nonzeros() const noexcept
+        { return this->_storage.values.size(); }
+
+    /**
+     * Retrieves the compressed storage (see maths::sparse::Compressed)
+     */
+    const storage_type& storage() const noexcept
+        { return this->_storage; }
+
+    /**
+     * Creates the dense matrix holding the same values
+     *
+     * @return                      Dense matrix
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> to_matrix() const
+    {
+        Matrix<K> result(this->_max_m, this->_max_n);
+        const size_type major = row_major ? this->_max_m : this->_max_n;
+        for (size_type i = 0; i < major; ++i)
+            for (size_type e = this->_storage.offsets[i]; e < this->_storage.offsets[i + 1]; ++e)
+            {
+                const size_type j = this->_storage.indices[e];
+                result[row_major ? std::make_pair(i, j) : std::make_pair(j, i)] = this->_storage.values[e];
+            }
+        return result;
+    }
+
+    /**
+     * Creates the transpose of the matrix, sharing the same storage
+     * compressed the other way (the transpose of a CSR matrix is a CSC one)
+     *
+     * @return                      Transposed matrix
+     */
+    SparseMatrix<K, row_major ? maths::sparse::Order::column : maths::sparse::Order::row> transpose() const
+    {
+        return SparseMatrix<K, row_major ? maths::sparse::Order::column : maths::sparse::Order::row>(
+            this->_max_n, this->_max_m, storage_type(this->_storage));
+    }
+
+    /**
+     * Multiplies every stored value by a scalar
+     *
+     * @param rhs                   Scalar value
+     * @return                      This matrix
+     */
+    SparseMatrix& operator*=(const value_type& rhs) noexcept
+    {
+        for (value_type& value : this->_storage.values)
+            value *= rhs;
+        return *this;
+    }
+
+    /**
+     * Calculates the product with a dense vector (SpMV). CSR products are
+     * split over the shared thread pool for large matrices
+     *
+     * @param rhs                   Vector or view to multiply with
+     * @return                      New vector containing the result
+     *
+     * @exception std::logic_error  Given vector doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Vector<K> operator*(const VectorView<const K>& rhs) const
+    {
+        if (this->_max_n != rhs.size())
+            throw std::logic_error("incompatible for multiplication");
+
+        Vector<K> result(this->_max_m);
+        const VectorView<K> out = result.view();
+        const storage_type& storage = this->_storage;
+        if (row_major)
+            maths::sparse::for_lines(storage.offsets, [&](const size_type& first, const size_type& last) {
+                for (size_type i = first; i < last; ++i)
+                {
+                    K sum = K();
+                    for (size_type e = storage.offsets[i]; e < storage.offsets[i + 1]; ++e)
+                        sum = maths::fma(storage.values[e], rhs[storage.indices[e]], sum);
+                    out[i] = sum;
+                }
+            });
+        else
+            for (size_type j = 0; j < this->_max_n; ++j)
+                for (size_type e = storage.offsets[j]; e < storage.offsets[j + 1]; ++e)
+                    out[storage.indices[e]] = maths::fma(storage.values[e], rhs[j], out[storage.indices[e]]);
+        return result;
+    }
+
+    /**
+     * Calculates the product with a dense matrix (SpMM), by adding scaled rows
+     * of the dense operand. CSR products are split over the shared thread pool
+     * for large matrices
+     *
+     * @param rhs                   Matrix or view to multiply with
+     * @return                      New matrix containing the result
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> operator*(const MatrixView<const K>& rhs) const
+    {
+        if (this->_max_n != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+
+        Matrix<K> result(this->_max_m, rhs.width());
+        K * const out = result.data();
+        const size_type ldc = result.stride();
+        const size_type width = rhs.width();
+        const storage_type& storage = this->_storage;
+        const auto axpy = [&](const K& value, const size_type& row, const size_type& k) {
+            const K * source = rhs.data() + k * rhs.stride();
+            K * target = out + row * ldc;
+            for (size_type j = 0; j < width; ++j)
+                target[j] = maths::fma(value, source[j], target[j]);
+        };
+
+        if (row_major)
+            maths::sparse::for_lines(storage.offsets, [&](const size_type& first, const size_type& last) {
+                for (size_type i = first; i < last; ++i)
+                    for (size_type e = storage.offsets[i]; e < storage.offsets[i + 1]; ++e)
+                        axpy(storage.values[e], i, storage.indices[e]);
+            });
+        else
+            for (size_type k = 0; k < this->_max_n; ++k)
+                for (size_type e = storage.offsets[k]; e < storage.offsets[k + 1]; ++e)
+                    axpy(storage.values[e], storage.indices[e], k);
+        return result;
+    }
+
+    /**
+     * Calculates the product with another sparse matrix (SpGEMM), compressed
+     * the same way as this one. Values cancelling out remain stored
+     *
+     * @param rhs                   Sparse matrix to multiply with
+     * @return                      New sparse matrix containing the result
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    SparseMatrix operator*(const SparseMatrix& rhs) const
+    {
+        if (this->_max_n != rhs._max_m)
+            throw std::logic_error("incompatible for multiplication");
+
+        // CSC storage is the CSR storage of the transpose: (AB)^T = B^T A^T
+        return SparseMatrix(this->_max_m, rhs._max_n, row_major
+            ? maths::sparse::multiply(this->_storage, rhs._storage, rhs._max_n)
+            : maths::sparse::multiply(rhs._storage, this->_storage, this->_max_m));
+    }
+
+    /**
+     * Calculates the product with a sparse matrix compressed the other way,
+     * converting it first
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < maths::sparse::Order P, typename = typename std::enable_if<P != O>::type >
+    SparseMatrix operator*(const SparseMatrix<K, P>& rhs) const
+    {
+        if (this->_max_n != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+        return *this * SparseMatrix(rhs);
+    }
+
+    SparseMatrix operator*(const value_type& rhs) const
+        { return SparseMatrix(*this) *= rhs; }
+
+private:
+    size_type       _max_m;     // Height of the matrix
+    size_type       _max_n;     // Width of the matrix
+    storage_type    _storage;   // Compressed values
+};
+
+template < class K, maths::sparse::Order O >
+constexpr bool SparseMatrix<K, O>::row_major;
+
+template < class K >
+using CSRMatrix = SparseMatrix<K, maths::sparse::Order::row>;
+
+template < class K >
+using CSCMatrix = SparseMatrix<K, maths::sparse::Order::column>;
+
+/**
+ * Gathers values by coordinates (COO), in any order, to build sparse matrices
+ * from. Values given several times at the same position are summed
+ *
+ * @tparam K        Matrix inner working type
+ */
+template < class K >
+class SparseBuilder
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+
+    /**
+     * Constructs an empty builder for a matrix of given size
+     *
+     * @param height                Height of the matrix (usually denoted `m`)
+     * @param width                 Width of the matrix (usually denoted `n`)
+     */
+    SparseBuilder(const size_type& height, const size_type& width) noexcept:
+        _max_m(height), _max_n(width), _rows(), _columns(), _values() {}
+
+    /**
+     * Reserves room for the given amount of values
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    void reserve(const size_type& count)
+    {
+        this->_rows.reserve(count);
+        this->_columns.reserve(count);
+        this->_values.reserve(count);
+    }
+
+    /**
+     * Adds a value at the given position
+     *
+     * @param m                     Row of the value
+     * @param n                     Column of the value
+     * @param value                 Value to add
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     * @exception std::bad_alloc    Allocation failure
+     */
+    void add(const size_type& m, const size_type& n, const value_type& value)
+    {
+        if (m >= this->_max_m || n >= this->_max_n)
+            throw std::out_of_range("position is out of range");
+        this->_rows.push_back(m);
+        this->_columns.push_back(n);
+        this->_values.push_back(value);
+    }
+
+    constexpr size_type height() const noexcept
+        { return this->_max_m; }
+
+    constexpr size_type width() const noexcept
+        { return this->_max_n; }
+
+    size_type size() const noexcept
+        { return this->_values.size(); }
+
+    /**
+     * Compresses the gathered values along rows (or columns): values are
+     * bucketed by row, then sorted by column within each row, and duplicates summed
+     *
+     * @param by_rows               TRUE to compress by rows, FALSE by columns
+     * @return                      Compressed storage
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    maths::sparse::Compressed<K> compress(const bool& by_rows) const
+    {
+        const std::vector<size_type>& major = by_rows ? this->_rows : this->_columns;
+        const std::vector<size_type>& minor = by_rows ? this->_columns : this->_rows;
+        const size_type lines = by_rows ? this->_max_m : this->_max_n;
+
+        std::vector<size_type> offsets(lines + 1, 0);
+        for (const size_type& i : major)
+            ++offsets[i + 1];
+        for (size_type i = 0; i < lines; ++i)
+            offsets[i + 1] += offsets[i];
+
+        std::vector<std::pair<size_type, K>> entries(this->_values.size());
+        std::vector<size_type> next(offsets.begin(), offsets.end() - 1);
+        for (size_type e = 0; e < this->_values.size(); ++e)
+            entries[next[major[e]]++] = { minor[e], this->_values[e] };
+
+        maths::sparse::Compressed<K> result;
+        result.offsets.reserve(lines + 1);
+        result.offsets.push_back(0);
+        result.indices.reserve(entries.size());
+        result.values.reserve(entries.size());
+        for (size_type i = 0; i < lines; ++i)
+        {
+            const auto first = entries.begin() + offsets[i];
+            const auto last = entries.begin() + offsets[i + 1];
+            std::stable_sort(first, last, [](const std::pair<size_type, K>& a, const std::pair<size_type, K>& b) {
+                return a.first < b.first;
+            });
+            for (auto entry = first; entry != last; ++entry)
+            {
+                if (result.indices.size() > result.offsets.back() && result.indices.back() == entry->first)
+                    result.values.back() += entry->second;
+                else
+                {
+                    result.indices.push_back(entry->first);
+                    result.values.push_back(entry->second);
+                }
+            }
+            result.offsets.push_back(result.indices.size());
+        }
+        return result;
+    }
+
+private:
+    size_type               _max_m;     // Height of the matrix
+    size_type               _max_n;     // Width of the matrix
+    std::vector<size_type>  _rows;      // Row of each value
+    std::vector<size_type>  _columns;   // Column of each value
+    std::vector<K>          _values;    // Gathered values
+};
+
+template < class K, maths::sparse::Order O >
+SparseMatrix<K, O>::SparseMatrix(const SparseBuilder<K>& builder):
+    _max_m(builder.height()), _max_n(builder.width()), _storage(builder.compress(row_major)) {}
+
+/**
+ * Writes the sparse matrix as a list of its stored values
+ *
+ * @tparam K        Matrix inner working type
+ * @param out       Output stream to write on
+ * @param value     Matrix to write
+ * @return          Returns output stream for chaining
+ */
+template < class K, maths::sparse::Order O >
+std::ostream& operator<<(std::ostream& out, const SparseMatrix<K, O>& value)
+{
+    const auto& storage = value.storage();
+    const bool row_major = SparseMatrix<K, O>::row_major;
+    out << '[' << value.height() << 'x' << value.width();
+    for (size_t i = 0; i + 1 < storage.offsets.size(); ++i)
+        for (size_t e = storage.offsets[i]; e < storage.offsets[i + 1]; ++e)
+            out << " (" << (row_major ? i : storage.indices[e]) << ", "
+                << (row_major ? storage.indices[e] : i) << "): " << storage.values[e];
+    return out << ']';
+}
+
+#endif //SPARSEMATRIX_HPP
@@ -0,0 +1,207 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - SymmetricMatrix.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [4:45 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef SYMMETRICMATRIX_HPP
+#define SYMMETRICMATRIX_HPP
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <iostream>
+#include "general.hpp"
+#include "AlignedAllocator.hpp"
+#include "TriangularMatrix.hpp"
+
+/**
+ * Symmetric square matrix, storing only its lower triangle packed row by row
+ * (about half the memory of a dense one). Both (m, n) and (n, m) refer to
+ * the same stored value
+ *
+ * @tparam K        Matrix inner working type
+ */
+template < class K >
+class SymmetricMatrix
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using storage_type = std::vector<K, maths::AlignedAllocator<K>>;
+
+    SymmetricMatrix() = delete;
+    ~SymmetricMatrix() = default;
+
+    /**
+     * Constructs a new matrix of given size, filled with a value
+     *
+     * @param size                  Height and width of the matrix
+     * @param value                 Value of every element
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit SymmetricMatrix(const size_type& size, const value_type& value = value_type()):
+        _size(size), _values(maths::packed::count(size), value) {}
+
+    /**
+     * Constructs a new matrix from the lower triangle of a dense one,
+     * ignoring the values above the diagonal
+     *
+     * @param other                 Square matrix to copy from
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    explicit SymmetricMatrix(const Matrix<K, A>& other):
+        SymmetricMatrix(other.height())
+    {
+        if (!other.square())
+            throw std::logic_error("symmetric matrices can only be built from a square matrix");
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = 0; n <= m; ++n)
+                (*this)(m, n) = other[{ m, n }];
+    }
+
+    /**
+     * Retrieves the value at the given position, with bounds checks
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    value_type& at(const size_type& m, const size_type& n)
+    {
+        if (m >= this->_size || n >= this->_size)
+            throw std::out_of_range("position is out of range");
+        return (*this)(m, n);
+    }
+
+    const value_type& at(const size_type& m, const size_type& n) const
+    {
+        if (m >= this->_size || n >= this->_size)
+            throw std::out_of_range("position is out of range");
+        return (*this)(m, n);
+    }
+
+    /**
+     * Retrieves the value at the given position
+     * (Caution: does not check for bounds)
+     */
+    value_type& operator()(const size_type& m, const size_type& n) noexcept
+        { return this->_values[m < n ? maths::packed::index<LOWER>(this->_size, n, m)
+                                     : maths::packed::index<LOWER>(this->_size, m, n)]; }
+
+    const value_type& operator()(const size_type& m, const size_type& n) const noexcept
+        { return this->_values[m < n ? maths::packed::index<LOWER>(this->_size, n, m)
+                                     : maths::packed::index<LOWER>(this->_size, m, n)]; }
+
+    constexpr shape_type shape() const noexcept
+        { return { this->_size, this->_size }; }
+
+    constexpr size_type height() const noexcept
+        { return this->_size; }
+
+    constexpr size_type width() const noexcept
+        { return this->_size; }
+
+    constexpr size_type size() const noexcept
+        { return this->_size; }
+
+    /**
+     * Retrieves the packed lower triangle, row by row
+     */
+    const storage_type& values() const noexcept
+        { return this->_values; }
+
+    /**
+     * Creates the dense matrix holding the same values
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> to_matrix() const
+    {
+        Matrix<K> result(this->_size, this->_size);
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = 0; n <= m; ++n)
+                result[{ m, n }] = result[{ n, m }] = (*this)(m, n);
+        return result;
+    }
+
+    /**
+     * Calculates the product with a vector (symv), reading each stored value once
+     *
+     * @param rhs                   Vector or view to multiply with
+     * @return                      New vector containing the result
+     *
+     * @exception std::logic_error  Given vector doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Vector<K> operator*(const VectorView<const K>& rhs) const
+    {
+        if (this->_size != rhs.size())
+            throw std::logic_error("incompatible for multiplication");
+        Vector<K> result(this->_size);
+        const value_type * value = this->_values.data();
+        for (size_type m = 0; m < this->_size; ++m)
+        {
+            value_type sum = value_type();
+            for (size_type n = 0; n < m; ++n, ++value)
+            {
+                sum = maths::fma(*value, rhs[n], sum);
+                result[n] = maths::fma(*value, rhs[m], result[n]);
+            }
+            result[m] = maths::fma(*value++, rhs[m], sum);
+        }
+        return result;
+    }
+
+    /**
+     * Calculates the product with a dense matrix (symm), reading each stored value once
+     *
+     * @param rhs                   Matrix or view to multiply with
+     * @return                      New matrix containing the result
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> operator*(const MatrixView<const K>& rhs) const
+    {
+        if (this->_size != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+        Matrix<K> result(this->_size, rhs.width());
+        const value_type * value = this->_values.data();
+        const auto row = [&](const size_type& m) { return rhs.data() + m * rhs.stride(); };
+        const auto out = [&](const size_type& m) { return result.data() + m * result.stride(); };
+        for (size_type m = 0; m < this->_size; ++m)
+        {
+            for (size_type n = 0; n < m; ++n, ++value)
+            {
+                maths::packed::axpy(rhs.width(), *value, row(n), out(m));
+                maths::packed::axpy(rhs.width(), *value, row(m), out(n));
+            }
+            maths::packed::axpy(rhs.width(), *value++, row(m), out(m));
+        }
+        return result;
+    }
+
+private:
+    static constexpr maths::packed::Triangle LOWER = maths::packed::Triangle::lower;
+
+    size_type       _size;      // Height and width of the matrix
+    storage_type    _values;    // Packed lower triangle, row by row
+};
+
+/**
+ * Writes the matrix in full
+ */
+template < class K >
+std::ostream& operator<<(std::ostream& out, const SymmetricMatrix<K>& value)
+    { return out << value.to_matrix(); }
+
+#endif //SYMMETRICMATRIX_HPP
@@ -0,0 +1,381 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - ThreadPool.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [1:27 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace maths
+{
+    /**
+     * Work-stealing thread pool: every worker owns a task queue, runs its own
+     * tasks from the back and steals from the front of the others when idle.
+     * The thread waiting on a parallel loop takes part in it too, which makes
+     * nested loops safe
+     */
+    class ThreadPool
+    {
+    public:
+        using size_type = size_t;
+        using task_type = std::function<void()>;
+
+        // Amount of work under which parallel_rows() stays on the calling thread,
+        // and given to each of its tasks otherwise
+        static constexpr size_type GRAIN = 64 * 1024;
+
+        ThreadPool() = delete;
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * Constructs a new pool
+         *
+         * @param threads               Total amount of threads, including the caller's
+         *
+         * @exception std::system_error Thread creation failure
+         */
+        explicit ThreadPool(const size_type& threads):
+            _queues(threads ? threads : 1), _stop(false), _pending(0)
+        {
+            for (auto& queue : this->_queues)
+                queue.reset(new Queue());
+            // Slot 0 is the one of external threads
+            for (size_type i = 1; i < this->_queues.size(); ++i)
+                this->_workers.emplace_back(&ThreadPool::_work, this, i);
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> guard(this->_sleep);
+                this->_stop = true;
+            }
+            this->_wake.notify_all();
+            for (auto& worker : this->_workers)
+                worker.join();
+        }
+
+        /**
+         * Retrieves the total amount of threads, including the caller's
+         *
+         * @return                      Amount of threads
+         */
+        size_type size() const noexcept
+            { return this->_queues.size(); }
+
+        /**
+         * Queues a task, on the current worker's queue if called from one
+         *
+         * @param task                  Task to run
+         */
+        void submit(task_type task)
+        {
+            Queue& queue = *this->_queues[ThreadPool::_index() % this->_queues.size()];
+            {
+                std::lock_guard<std::mutex> guard(queue.lock);
+                queue.tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> guard(this->_sleep);
+                ++this->_pending;
+            }
+            this->_wake.notify_one();
+        }
+
+        /**
+         * Runs `body(i)` for every `i` in [0, count), spread over the pool,
+         * and waits for all of them. The first exception thrown is rethrown
+         *
+         * @param count                 Amount of iterations
+         * @param body                  Function to run on each iteration
+         *
+         * @exception std::bad_alloc    Allocation failure, once the queued iterations are done
+         */
+        template < class F >
+        void parallel_for(const size_type& count, const F& body)
+        {
+            if (count == 1 || this->size() == 1)
+            {
+                for (size_type i = 0; i < count; ++i)
+                    body(i);
+                return;
+            }
+
+            std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+            batch->remaining = count;
+
+            size_type queued = 0;
+            try
+            {
+                for (; queued < count; ++queued)
+                {
+                    const size_type i = queued;
+                    this->submit([batch, &body, i]() {
+                        std::exception_ptr error;
+                        try
+                            { body(i); }
+                        catch (...)
+                            { error = std::current_exception(); }
+                        std::lock_guard<std::mutex> guard(batch->lock);
+                        if (error && !batch->error)
+                            batch->error = error;
+                        if (!--batch->remaining)
+                            batch->done.notify_all();
+                    });
+                }
+            }
+            catch (...)
+            {
+                // Queued tasks still refer to body, which must outlive them
+                {
+                    std::lock_guard<std::mutex> guard(batch->lock);
+                    batch->remaining -= count - queued;
+                }
+                this->_join(*batch);
+                throw;
+            }
+            this->_join(*batch);
+
+            if (batch->error)
+                std::rethrow_exception(batch->error);
+        }
+
+        /**
+         * Runs `body(begin, end)` over consecutive ranges of [first, last),
+         * spread over the pool in tasks of about GRAIN units of work, or at
+         * once on the calling thread when there is too little to share
+         *
+         * @param first                 First row
+         * @param last                  End of the rows
+         * @param work_per_row          Amount of work of a single row, in any unit
+         *                              (elements, words or multiply-adds)
+         * @param body                  Function to run on each range
+         */
+        template < class F >
+        void parallel_rows(const size_type& first, const size_type& last, const size_type& work_per_row, const F& body)
+        {
+            const size_type rows = last > first ? last - first : 0;
+            if (this->size() == 1 || rows * work_per_row < GRAIN)
+                return body(first, first + rows);
+            const size_type chunk = std::max<size_type>(1, GRAIN / std::max<size_type>(1, work_per_row));
+            this->parallel_for((rows + chunk - 1) / chunk, [&](const size_type& c) {
+                body(first + c * chunk, std::min(last, first + (c + 1) * chunk));
+            });
+        }
+
+        /**
+         * Retrieves the pool shared by the library's operations.
+         * Its size is, in order of priority, the one given to `set_threads`,
+         * the `MATRIX_NUM_THREADS` environment variable or the hardware concurrency
+         *
+         * @return                      Shared pool
+         */
+        static ThreadPool& global()
+        {
+            ThreadPool* current = ThreadPool::_current().load(std::memory_order_acquire);
+            if (current)
+                return *current;
+            std::lock_guard<std::mutex> guard(ThreadPool::_global_lock());
+            std::unique_ptr<ThreadPool>& pool = ThreadPool::_global();
+            if (!pool)
+            {
+                pool.reset(new ThreadPool(ThreadPool::default_threads()));
+                ThreadPool::_current().store(pool.get(), std::memory_order_release);
+            }
+            return *pool;
+        }
+
+        /**
+         * Resizes the shared pool. Must not be called while operations run on it
+         *
+         * @param threads               Total amount of threads (0 for the default)
+         */
+        static void set_threads(const size_type& threads)
+        {
+            std::lock_guard<std::mutex> guard(ThreadPool::_global_lock());
+            std::unique_ptr<ThreadPool>& pool = ThreadPool::_global();
+            ThreadPool::_current().store(nullptr, std::memory_order_release);
+            pool.reset();
+            pool.reset(new ThreadPool(threads ? threads : ThreadPool::default_threads()));
+            ThreadPool::_current().store(pool.get(), std::memory_order_release);
+        }
+
+        /**
+         * Retrieves the amount of threads of the shared pool
+         *
+         * @return                      Amount of threads
+         */
+        static size_type threads()
+            { return ThreadPool::global().size(); }
+
+        /**
+         * Retrieves the default amount of threads, from `MATRIX_NUM_THREADS`
+         * or the hardware concurrency
+         *
+         * @return                      Default amount of threads
+         */
+        static size_type default_threads()
+        {
+            const char* env = std::getenv("MATRIX_NUM_THREADS");
+            if (env)
+            {
+                const long value = std::strtol(env, nullptr, 10);
+                if (value > 0)
+                    return static_cast<size_type>(value);
+            }
+            const size_type hardware = std::thread::hardware_concurrency();
+            return hardware ? hardware : 1;
+        }
+
+    private:
+        struct Queue
+        {
+            std::mutex              lock;
+            std::deque<task_type>   tasks;
+        };
+
+        // Progress of a parallel loop, shared with its tasks
+        struct Batch
+        {
+            std::mutex              lock;
+            std::condition_variable done;
+            size_type               remaining;
+            std::exception_ptr      error;
+        };
+
+        /**
+         * Runs tasks until the given loop is done, then sleeps until it is
+         * when there are none left to run
+         *
+         * @param batch                 Loop to wait for
+         */
+        void _join(Batch& batch)
+        {
+            const size_type home = ThreadPool::_index() % this->_queues.size();
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(batch.lock);
+                    if (!batch.remaining)
+                        return;
+                }
+                if (this->_run_one(home))
+                    continue;
+                std::unique_lock<std::mutex> lock(batch.lock);
+                batch.done.wait(lock, [&batch]() { return !batch.remaining; });
+                return;
+            }
+        }
+
+        /**
+         * Runs a single task, from the given queue's back,
+         * or stolen from the front of another one
+         *
+         * @param home                  Index of the queue to look first into
+         * @return                      TRUE if a task was run, otherwise FALSE
+         */
+        bool _run_one(const size_type& home)
+        {
+            task_type task;
+            const size_type count = this->_queues.size();
+            for (size_type i = 0; i < count && !task; ++i)
+            {
+                Queue& queue = *this->_queues[(home + i) % count];
+                std::lock_guard<std::mutex> guard(queue.lock);
+                if (queue.tasks.empty())
+                    continue;
+                if (!i)
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+            }
+            if (!task)
+                return false;
+            {
+                std::lock_guard<std::mutex> guard(this->_sleep);
+                --this->_pending;
+            }
+            task();
+            return true;
+        }
+
+        /**
+         * Worker's main loop
+         *
+         * @param index                 Index of the worker's queue
+         */
+        void _work(const size_type index)
+        {
+            ThreadPool::_index() = index;
+            while (true)
+            {
+                if (this->_run_one(index))
+                    continue;
+                std::unique_lock<std::mutex> lock(this->_sleep);
+                this->_wake.wait(lock, [this]() { return this->_stop || this->_pending; });
+                if (this->_stop)
+                    return;
+            }
+        }
+
+        // Index of the queue owned by the current thread (0 outside of the pool)
+        static size_type& _index()
+        {
+            static thread_local size_type index = 0;
+            return index;
+        }
+
+        static std::unique_ptr<ThreadPool>& _global()
+        {
+            static std::unique_ptr<ThreadPool> pool;
+            return pool;
+        }
+
+        // Shared pool once created, read without taking the lock
+        static std::atomic<ThreadPool*>& _current()
+        {
+            static std::atomic<ThreadPool*> pool(nullptr);
+            return pool;
+        }
+
+        static std::mutex& _global_lock()
+        {
+            static std::mutex lock;
+            return lock;
+        }
+
+        std::vector<std::unique_ptr<Queue>> _queues;    // Task queues, one per thread
+        std::vector<std::thread>            _workers;   // Worker threads
+        std::mutex                          _sleep;     // Guards the sleeping state
+        std::condition_variable             _wake;      // Wakes up idle workers
+        bool                                _stop;      // Whether workers must exit
+        size_type                           _pending;   // Amount of queued tasks
+    };
+}
+
+#endif //THREADPOOL_HPP
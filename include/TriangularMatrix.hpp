@@ -0,0 +1,383 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - TriangularMatrix.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [4:10 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef TRIANGULARMATRIX_HPP
+#define TRIANGULARMATRIX_HPP
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <iostream>
+#include "general.hpp"
+#include "AlignedAllocator.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+namespace maths
+{
+namespace packed
+{
+    /**
+     * Triangle of a square matrix holding its values
+     */
+    enum class Triangle
+    {
+        lower,  // On and below the diagonal
+        upper   // On and above the diagonal
+    };
+
+    /**
+     * Retrieves the amount of values of a triangle of an n x n matrix
+     */
+    constexpr size_t count(const size_t& n) noexcept
+        { return n * (n + 1) / 2; }
+
+    /**
+     * Retrieves the position of (m, n) within a triangle of a size x size matrix
+     * packed row by row. The position must lie within the triangle
+     */
+    template < Triangle T >
+    constexpr size_t index(const size_t& size, const size_t& m, const size_t& n) noexcept
+    {
+        return T == Triangle::lower ? m * (m + 1) / 2 + n
+                                    : m * (2 * size - m + 1) / 2 + n - m;
+    }
+
+    /**
+     * Adds `factor * x` to y, over the given amount of elements
+     */
+    template < class K >
+    void axpy(const size_t& count, const K& factor, const K * x, K * y)
+    {
+        if (factor == K())
+            return;
+        for (size_t c = 0; c < count; ++c)
+            y[c] = maths::fma(factor, x[c], y[c]);
+    }
+}
+}
+
+/**
+ * Triangular square matrix, storing only its triangle packed row by row
+ * (about half the memory of a dense one). Products and triangular solves
+ * (trsv/trsm) only go through the stored values
+ *
+ * @tparam K        Matrix inner working type
+ * @tparam T        Triangle holding the values (see maths::packed::Triangle)
+ */
+template < class K, maths::packed::Triangle T = maths::packed::Triangle::lower >
+class TriangularMatrix
+{
+public:
+    using value_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using storage_type = std::vector<K, maths::AlignedAllocator<K>>;
+
+    static constexpr bool lower = T == maths::packed::Triangle::lower;
+
+    TriangularMatrix() = delete;
+    ~TriangularMatrix() = default;
+
+    /**
+     * Constructs a new matrix of given size, the triangle being filled with a value
+     *
+     * @param size                  Height and width of the matrix
+     * @param value                 Value of the triangle
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit TriangularMatrix(const size_type& size, const value_type& value = value_type()):
+        _size(size), _values(maths::packed::count(size), value) {}
+
+    /**
+     * Constructs a new matrix from the triangle of a dense one,
+     * ignoring the values outside of it
+     *
+     * @param other                 Square matrix to copy from
+     *
+     * @exception std::logic_error  Matrix is not square
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class A >
+    explicit TriangularMatrix(const Matrix<K, A>& other):
+        TriangularMatrix(other.height())
+    {
+        if (!other.square())
+            throw std::logic_error("triangular matrices can only be built from a square matrix");
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = this->_first(m); n < this->_last(m); ++n)
+                (*this)(m, n) = other[{ m, n }];
+    }
+
+    /**
+     * Retrieves the value at the given position, zero outside of the triangle
+     *
+     * @exception std::out_of_range Given position points out of the matrix
+     */
+    value_type at(const size_type& m, const size_type& n) const
+    {
+        if (m >= this->_size || n >= this->_size)
+            throw std::out_of_range("position is out of range");
+        if (!this->stored(m, n))
+            return value_type();
+        return (*this)(m, n);
+    }
+
+    /**
+     * Retrieves the stored value at the given position
+     * (Caution: does not check the position lies within the triangle)
+     */
+    value_type& operator()(const size_type& m, const size_type& n) noexcept
+        { return this->_values[maths::packed::index<T>(this->_size, m, n)]; }
+
+    const value_type& operator()(const size_type& m, const size_type& n) const noexcept
+        { return this->_values[maths::packed::index<T>(this->_size, m, n)]; }
+
+    /**
+     * Checks whether the given position lies within the triangle
+     */
+    constexpr bool stored(const size_type& m, const size_type& n) const noexcept
+        { return lower ? n <= m : m <= n; }
+
+    constexpr shape_type shape() const noexcept
+        { return { this->_size, this->_size }; }
+
+    constexpr size_type height() const noexcept
+        { return this->_size; }
+
+    constexpr size_type width() const noexcept
+        { return this->_size; }
+
+    constexpr size_type size() const noexcept
+        { return this->_size; }
+
+    /**
+     * Retrieves the packed triangle, row by row
+     */
+    const storage_type& values() const noexcept
+        { return this->_values; }
+
+    /**
+     * Creates the dense matrix holding the same values
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> to_matrix() const
+    {
+        Matrix<K> result(this->_size, this->_size);
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = this->_first(m); n < this->_last(m); ++n)
+                result[{ m, n }] = (*this)(m, n);
+        return result;
+    }
+
+    /**
+     * Calculates the determinant, as the product of the diagonal
+     */
+    value_type determinant() const noexcept
+    {
+        value_type result = 1;
+        for (size_type i = 0; i < this->_size; ++i)
+            result *= (*this)(i, i);
+        return result;
+    }
+
+    /**
+     * Calculates the product with a vector (trmv)
+     *
+     * @param rhs                   Vector or view to multiply with
+     * @return                      New vector containing the result
+     *
+     * @exception std::logic_error  Given vector doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Vector<K> operator*(const VectorView<const K>& rhs) const
+    {
+        if (this->_size != rhs.size())
+            throw std::logic_error("incompatible for multiplication");
+        Vector<K> result(this->_size);
+        for (size_type m = 0; m < this->_size; ++m)
+        {
+            const value_type * row = &(*this)(m, this->_first(m));
+            value_type sum = value_type();
+            for (size_type n = this->_first(m); n < this->_last(m); ++n)
+                sum = maths::fma(*row++, rhs[n], sum);
+            result[m] = sum;
+        }
+        return result;
+    }
+
+    /**
+     * Calculates the product with a dense matrix (trmm)
+     *
+     * @param rhs                   Matrix or view to multiply with
+     * @return                      New matrix containing the result
+     *
+     * @exception std::logic_error  Given matrix doesn't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> operator*(const MatrixView<const K>& rhs) const
+    {
+        if (this->_size != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+        Matrix<K> result(this->_size, rhs.width());
+        for (size_type m = 0; m < this->_size; ++m)
+            for (size_type n = this->_first(m); n < this->_last(m); ++n)
+                maths::packed::axpy(rhs.width(), (*this)(m, n), rhs.data() + n * rhs.stride(),
+                                    result.data() + m * result.stride());
+        return result;
+    }
+
+    /**
+     * Solves the system `Ax = b` by substitution (trsv)
+     *
+     * @param rhs                   Right-hand side
+     * @return                      Solution
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Vector<K> solve(const VectorView<const K>& rhs) const
+    {
+        Vector<K> result(rhs);
+        this->solve_inplace(result.view());
+        return result;
+    }
+
+    /**
+     * Solves the system `AX = B` for every column of B at once (trsm)
+     *
+     * @param rhs                   Right-hand sides, one per column
+     * @return                      Solutions, one per column
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     * @exception std::bad_alloc    Allocation failure
+     */
+    Matrix<K> solve(const MatrixView<const K>& rhs) const
+    {
+        Matrix<K> result(rhs);
+        this->solve_inplace(result.view());
+        return result;
+    }
+
+    /**
+     * Solves the system `Ax = b`, overwriting b with the solution
+     *
+     * @param rhs                   Right-hand side, such as a vector or a column
+     *
+     * @exception std::logic_error  Right-hand side is not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     */
+    void solve_inplace(const VectorView<K>& rhs) const
+    {
+        if (rhs.size() != this->_size)
+            throw std::logic_error("cannot solve with different matrix heights");
+        this->_substitute(rhs.data(), 1, rhs.step());
+    }
+
+    /**
+     * Solves the system `AX = B`, overwriting B with the solutions
+     *
+     * @param rhs                   Right-hand sides, such as a matrix or a block
+     *
+     * @exception std::logic_error  Right-hand sides are not of the matrix' height
+     * @exception std::runtime_error Matrix is singular
+     */
+    void solve_inplace(const MatrixView<K>& rhs) const
+    {
+        if (rhs.height() != this->_size)
+            throw std::logic_error("cannot solve with different matrix heights");
+        this->_substitute(rhs.data(), rhs.width(), rhs.stride());
+    }
+
+private:
+    /**
+     * First and past-the-last stored columns of a row
+     */
+    constexpr size_type _first(const size_type& m) const noexcept
+        { return lower ? 0 : m; }
+
+    constexpr size_type _last(const size_type& m) const noexcept
+        { return lower ? m + 1 : this->_size; }
+
+    /**
+     * Substitutes a row-major block of right-hand sides row by row, from the
+     * top for lower matrices and from the bottom for upper ones
+     *
+     * @param b                     Right-hand sides, of `size()` rows
+     * @param width                 Amount of right-hand sides
+     * @param ldb                   Distance between two rows of `b`
+     */
+    void _substitute(value_type * b, const size_type& width, const size_type& ldb) const
+    {
+        for (size_type i = 0; i < this->_size; ++i)
+            if ((*this)(i, i) == value_type())
+                throw std::runtime_error("cannot solve a singular system");
+
+        for (size_type step = 0; step < this->_size; ++step)
+        {
+            const size_type i = lower ? step : this->_size - 1 - step;
+            value_type * row = b + i * ldb;
+            for (size_type n = this->_first(i); n < this->_last(i); ++n)
+                if (n != i)
+                    maths::packed::axpy(width, -(*this)(i, n), b + n * ldb, row);
+            const value_type diagonal = (*this)(i, i);
+            for (size_type c = 0; c < width; ++c)
+                row[c] /= diagonal;
+        }
+    }
+
+    size_type       _size;      // Height and width of the matrix
+    storage_type    _values;    // Packed triangle, row by row
+};
+
+template < class K, maths::packed::Triangle T >
+constexpr bool TriangularMatrix<K, T>::lower;
+
+template < class K >
+using LowerMatrix = TriangularMatrix<K, maths::packed::Triangle::lower>;
+
+template < class K >
+using UpperMatrix = TriangularMatrix<K, maths::packed::Triangle::upper>;
+
+/**
+ * Solves the system `Ax = b` for a triangular A, by substitution
+ *
+ * @exception std::logic_error   b is not of A's height
+ * @exception std::runtime_error A is singular
+ * @exception std::bad_alloc     Allocation failure
+ */
+template < class K, maths::packed::Triangle T, class B >
+Vector<K> solve(const TriangularMatrix<K, T>& a, const Vector<K, B>& b)
+    { return a.solve(b); }
+
+/**
+ * Solves the system `AX = B` for a triangular A, by substitution
+ *
+ * @exception std::logic_error   B is not of A's height
+ * @exception std::runtime_error A is singular
+ * @exception std::bad_alloc     Allocation failure
+ */
+template < class K, maths::packed::Triangle T, class B >
+Matrix<K> solve(const TriangularMatrix<K, T>& a, const Matrix<K, B>& b)
+    { return a.solve(b); }
+
+/**
+ * Writes the matrix, with the zeros outside of the triangle
+ */
+template < class K, maths::packed::Triangle T >
+std::ostream& operator<<(std::ostream& out, const TriangularMatrix<K, T>& value)
+    { return out << value.to_matrix(); }
+
+#endif //TRIANGULARMATRIX_HPP
@@ -17,30 +17,36 @@
 #include <iostream>
 #include "general.hpp"
 
-// Forward declaration
-template < class K >
+// Forward declarations...
+template < class K, class Alloc >
 class Matrix;
 
+template < class K >
+class VectorView;
+
 #include "Matrix.hpp"
 
 /**
  * Represents a mathematical vector, acting as a wrapper for Matrix
  *
- * @tparam K    Vector's inner working type
+ * @tparam K        Vector's inner working type
+ * @tparam Alloc    Allocator of the values, given to the inner matrix
  */
-template < class K >
+template < class K, class Alloc = maths::AlignedAllocator<K> >
 class Vector
 {
 public:
-    using value_type  = typename Matrix<K>::value_type;
-    using size_type   = typename Matrix<K>::size_type;
-    using shape_type  = typename Matrix<K>::shape_type;
+    using value_type  = typename Matrix<K, Alloc>::value_type;
+    using size_type   = typename Matrix<K, Alloc>::size_type;
+    using shape_type  = typename Matrix<K, Alloc>::shape_type;
+    using allocator_type = Alloc;
 
     Vector() = delete;
     ~Vector() = default;
 
-    explicit Vector(const size_type& height, const value_type& value = value_type()):
-        _matrix(height, 1, value) {}
+    explicit Vector(const size_type& height, const value_type& value = value_type(),
+                    const allocator_type& allocator = allocator_type()):
+        _matrix(height, 1, value, allocator) {}
 
     Vector(const size_type& height, const std::vector<value_type>& data):
         _matrix(height, 1, data) {}
@@ -59,21 +65,87 @@ public:
         _matrix(std::move(other._matrix)) {}
 
     template <typename = typename
-        std::enable_if<std::is_same<Matrix<value_type>, Matrix<value_type>>::value>::type>
-    explicit Vector(const Matrix<value_type>& other):
+        std::enable_if<std::is_same<Matrix<value_type, Alloc>, Matrix<value_type, Alloc>>::value>::type>
+    explicit Vector(const Matrix<value_type, Alloc>& other):
         _matrix(other) {}
 
     template <typename = typename
-        std::enable_if<std::is_same<Matrix<value_type>, Matrix<value_type>>::value>::type>
-    explicit Vector(Matrix<value_type>&& other) noexcept:
+        std::enable_if<std::is_same<Matrix<value_type, Alloc>, Matrix<value_type, Alloc>>::value>::type>
+    explicit Vector(Matrix<value_type, Alloc>&& other) noexcept:
         _matrix(std::move(other)) {}
 
+    /**
+     * Constructs a new vector adopting the storage of the given array
+     * instead of copying it
+     *
+     * @param data                  Array of values to adopt
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    explicit Vector(std::vector<value_type>&& data):
+        _matrix(data.size(), 1, std::move(data)) {}
+
+    /**
+     * Creates a vector over caller-owned storage, without copying it.
+     * The storage is never freed by the vector, and must outlive it
+     *
+     * @param data                  First element
+     * @param size                  Amount of elements
+     * @param step                  Distance between two elements
+     * @return                      Vector borrowing the storage
+     */
+    static Vector borrow(value_type * data, const size_type& size, const size_type& step = 1)
+        { return Vector(Matrix<value_type, Alloc>::borrow(data, size, 1, step)); }
+
+    /**
+     * Creates a vector taking ownership of storage, without copying it.
+     * The deleter is called on the storage once the vector releases it
+     *
+     * @param data                  First element
+     * @param size                  Amount of elements
+     * @param step                  Distance between two elements
+     * @param deleter               Callable releasing the storage
+     * @return                      Vector owning the storage
+     *
+     * @exception std::bad_alloc    Allocation failure (the deleter is then called)
+     */
+    template < class D >
+    static Vector adopt(value_type * data, const size_type& size, const size_type& step, D deleter)
+        { return Vector(Matrix<value_type, Alloc>::adopt(data, size, 1, step, std::move(deleter))); }
+
+    /**
+     * Checks if the storage is borrowed from the caller (see Vector::borrow())
+     *
+     * @return                      TRUE if borrowed, otherwise FALSE
+     */
+    bool borrowed() const noexcept
+        { return this->_matrix.borrowed(); }
+
+    /**
+     * Constructs a new vector by evaluating an element-wise expression,
+     * in a single pass and without temporaries
+     *
+     * @param expr                  Expression to evaluate
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Vector>::value>::type >
+    Vector(const maths::expr::Expression<E>& expr):
+        _matrix(expr.self().height(), 1)
+        { maths::expr::evaluate(expr, this->_matrix._data, this->_matrix._stride, maths::expr::assign()); }
+
     Vector& operator=(const Vector& rhs)
         { this->_matrix = rhs._matrix; return *this; }
 
     Vector& operator=(Vector&& rhs) noexcept
         { this->_matrix = std::move(rhs._matrix); return *this; }
 
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Vector>::value>::type >
+    Vector& operator=(const maths::expr::Expression<E>& rhs)
+        { this->_matrix._assign(rhs.self()); return *this; }
+
     Vector& operator+=(const Vector& rhs)
         { this->_matrix += rhs._matrix; return *this; }
 
@@ -104,16 +176,34 @@ public:
         return tmp;
     }
 
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Vector>::value>::type >
+    Vector& operator+=(const maths::expr::Expression<E>& rhs)
+    {
+        this->_matrix._check_shape(rhs.self());
+        maths::expr::evaluate(rhs, this->_matrix._data, this->_matrix._stride, maths::expr::add_assign());
+        return *this;
+    }
+
+    template < class E, typename = typename
+        std::enable_if<std::is_same<typename E::result_type, Vector>::value>::type >
+    Vector& operator-=(const maths::expr::Expression<E>& rhs)
+    {
+        this->_matrix._check_shape(rhs.self());
+        maths::expr::evaluate(rhs, this->_matrix._data, this->_matrix._stride, maths::expr::sub_assign());
+        return *this;
+    }
+
     bool operator==(const Vector& rhs) const
         { return this->_matrix == rhs._matrix; }
 
     bool operator!=(const Vector& rhs) const
         { return this->_matrix != rhs._matrix; }
 
-    bool operator==(const Matrix<K>& rhs) const
+    bool operator==(const Matrix<K, Alloc>& rhs) const
         { return this->_matrix == rhs; }
 
-    bool operator!=(const Matrix<K>& rhs) const
+    bool operator!=(const Matrix<K, Alloc>& rhs) const
         { return this->_matrix != rhs; }
 
     value_type& at(const size_type& m)
@@ -155,13 +245,17 @@ public:
     void check_sizes(const Vector& other) const
         { return this->_matrix.check_sizes(other._matrix); }
 
-    value_type dot(const Vector& other) const
+    /**
+     * Calculates the dot product with another vector, accumulated in R
+     * (e.g. `dot<double>` on floats, keeping long sums accurate)
+     *
+     * @exception std::logic_error  Given vector is of different size
+     */
+    template < class R = value_type >
+    R dot(const Vector& other) const
     {
         this->check_sizes(other);
-        value_type result = value_type();
-        for (size_type i = 0; i < this->size(); ++i)
-            result = maths::fma((*this)[i], other[i], result);
-        return result;
+        return this->view().template dot<R>(other.view());
     }
 
     /**
@@ -171,12 +265,7 @@ public:
      * @return                      Value of the norm
      */
     double norm_1() const
-    {
-        value_type tmp = 0;
-        for (size_type i = 0; i < this->size(); ++i)
-            tmp += std::max((*this)[i], -(*this)[i]);
-        return static_cast<double>(tmp);
-    }
+        { return this->view().norm_1(); }
 
     /**
      * Calculates the 2-norm (Euclidean norm) for this vector
@@ -185,12 +274,7 @@ public:
      * @return                      Value of the norm
      */
     double norm_2() const
-    {
-        double tmp = 0;
-        for (size_type i = 0; i < this->size(); ++i)
-            tmp += std::pow(static_cast<double>((*this)[i]), 2.);
-        return std::pow(tmp, .5);
-    }
+        { return this->view().norm_2(); }
 
     /**
      * Calculates the inf-norm (Supremum norm) for this vector.
@@ -199,12 +283,33 @@ public:
      * @return                      Value of the norm
      */
     double norm_inf() const
-    {
-        value_type tmp = 0;
-        for (size_type i = 0; i < this->size(); ++i)
-            tmp = std::max(tmp, std::max((*this)[i], -(*this)[i]));
-        return static_cast<double>(tmp);
-    }
+        { return this->view().norm_inf(); }
+
+    /**
+     * Views the whole vector, without copying it
+     *
+     * @return                      View over the vector
+     */
+    VectorView<value_type> view() noexcept
+        { return VectorView<value_type>(this->_matrix.data(), this->size(), this->_matrix.stride()); }
+
+    VectorView<const value_type> view() const noexcept
+        { return VectorView<const value_type>(this->_matrix.data(), this->size(), this->_matrix.stride()); }
+
+    /**
+     * Views a contiguous range of the vector, without copying it
+     *
+     * @param start                 First element of the range
+     * @param count                 Amount of elements
+     * @return                      View over the range
+     *
+     * @exception std::out_of_range Range does not fit within the vector
+     */
+    VectorView<value_type> segment(const size_type& start, const size_type& count)
+        { return this->view().segment(start, count); }
+
+    VectorView<const value_type> segment(const size_type& start, const size_type& count) const
+        { return this->view().segment(start, count); }
 
     /**
      * Converts the vector into a matrix by copy
@@ -212,7 +317,7 @@ public:
      * @return                      Ready to use matrix
      * @exception std::bad_alloc    Allocation failure
      */
-    Matrix<value_type> to_matrix() const
+    Matrix<value_type, Alloc> to_matrix() const
     { return _matrix; }
 
     /////// SUBJECT REQUIREMENTS ///////
@@ -228,25 +333,25 @@ public:
     { *this *= rhs; }
 
 private:
-    friend Matrix<value_type>;
+    friend Matrix<value_type, Alloc>;
 
-    Matrix<value_type>     _matrix; // Vector's inner matrix
+    Matrix<value_type, Alloc>   _matrix;    // Vector's inner matrix
 };
 
-template < class K >
-Vector<K> operator*(const typename Vector<K>::value_type& lhs, const Vector<K>& rhs)
+template < class K, class A >
+Vector<K, A> operator*(const typename Vector<K, A>::value_type& lhs, const Vector<K, A>& rhs)
     { return rhs.operator*(lhs); }
 
-template < class K >
-bool operator==(const Matrix<K>& lhs, const Vector<K>& rhs)
+template < class K, class A >
+bool operator==(const Matrix<K, A>& lhs, const Vector<K, A>& rhs)
     { return rhs == lhs; }
 
-template < class K >
-bool operator!=(const Matrix<K>& lhs, const Vector<K>& rhs)
+template < class K, class A >
+bool operator!=(const Matrix<K, A>& lhs, const Vector<K, A>& rhs)
     { return rhs != lhs; }
 
-template < class K >
-std::ostream& operator<<(std::ostream& out, const Vector<K>& value)
+template < class K, class A >
+std::ostream& operator<<(std::ostream& out, const Vector<K, A>& value)
     { return out << value.to_matrix(); }
 
 using f64Vector = Vector<double>;               // Helper type for double Vector
@@ -0,0 +1,275 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - VectorView.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [10:50 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef VECTORVIEW_HPP
+#define VECTORVIEW_HPP
+
+#include <cmath>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "general.hpp"
+#include "blas.hpp"
+#include "Expression.hpp"
+#include "Vector.hpp"
+
+/**
+ * Non-owning view over elements evenly spaced in memory, such as a vector,
+ * a row, a column or a diagonal of a matrix. Views take part in expressions
+ * like vectors, without copying what they refer to, and writing through
+ * them updates the viewed buffer
+ *
+ * A view is a handle: copying one refers to the same elements, while
+ * assigning to one writes into them. It must not outlive what it views,
+ * nor be assigned from a view overlapping it at another position
+ *
+ * @tparam K    Element type, `const` for read-only views
+ */
+template < class K >
+class VectorView: public maths::expr::Expression<VectorView<K>>
+{
+public:
+    using value_type = typename std::remove_const<K>::type;
+    using element_type = K;
+    using size_type = size_t;
+    using shape_type = std::pair<size_type, size_type>;
+    using result_type = Vector<value_type>;
+
+    VectorView() = delete;
+    ~VectorView() = default;
+
+    /**
+     * Constructs a view over evenly spaced elements
+     *
+     * @param data                  First element
+     * @param size                  Amount of elements
+     * @param step                  Distance between two elements
+     */
+    VectorView(K * data, const size_type& size, const size_type& step = 1) noexcept:
+        _data(data), _size(size), _step(step) {}
+
+    /**
+     * Constructs a view over a whole vector
+     *
+     * @param vector                Viewed vector
+     */
+    template < class A >
+    VectorView(Vector<value_type, A>& vector) noexcept:
+        VectorView(vector.view()) {}
+
+    template < class A, class T = K, typename = typename std::enable_if<std::is_const<T>::value>::type >
+    VectorView(const Vector<value_type, A>& vector) noexcept:
+        VectorView(vector.view()) {}
+
+    /**
+     * Constructs a read-only view from a writable one
+     */
+    template < class T, typename = typename
+        std::enable_if<std::is_same<const T, K>::value && !std::is_same<T, K>::value>::type >
+    VectorView(const VectorView<T>& other) noexcept:
+        VectorView(other.data(), other.size(), other.step()) {}
+
+    VectorView(const VectorView& other) = default;
+
+    /**
+     * Writes the values of another operand of the same size into the view
+     *
+     * @param rhs                   Vector, view or expression to write
+     * @return                      This view
+     *
+     * @exception std::logic_error  Given operand is of different size
+     */
+    VectorView& operator=(const VectorView& rhs)
+        { return this->_write(rhs, maths::expr::assign()); }
+
+    template < class T >
+    typename std::enable_if<maths::expr::is_operand<T>::value, VectorView&>::type
+    operator=(const T& rhs)
+        { return this->_write(rhs, maths::expr::assign()); }
+
+    /**
+     * Adds another operand of the same size to the viewed values
+     *
+     * @exception std::logic_error  Given operand is of different size
+     */
+    template < class T >
+    typename std::enable_if<maths::expr::is_operand<T>::value, VectorView&>::type
+    operator+=(const T& rhs)
+        { return this->_write(rhs, maths::expr::add_assign()); }
+
+    /**
+     * Subtracts another operand of the same size from the viewed values
+     *
+     * @exception std::logic_error  Given operand is of different size
+     */
+    template < class T >
+    typename std::enable_if<maths::expr::is_operand<T>::value, VectorView&>::type
+    operator-=(const T& rhs)
+        { return this->_write(rhs, maths::expr::sub_assign()); }
+
+    /**
+     * Multiplies the viewed values by a scalar
+     *
+     * @param rhs                   Scalar value
+     * @return                      This view
+     */
+    VectorView& operator*=(const value_type& rhs) noexcept
+    {
+        static_assert(!std::is_const<K>::value, "cannot write through a read-only view");
+        for (size_type i = 0; i < this->_size; ++i)
+            this->_data[i * this->_step] *= rhs;
+        return *this;
+    }
+
+    /**
+     * Sets every viewed value to the given one
+     *
+     * @param value                 Value to fill with
+     */
+    void fill(const value_type& value) noexcept
+    {
+        static_assert(!std::is_const<K>::value, "cannot write through a read-only view");
+        for (size_type i = 0; i < this->_size; ++i)
+            this->_data[i * this->_step] = value;
+    }
+
+    /**
+     * Retrieves the element at the given position, with bounds checks
+     *
+     * @exception std::out_of_range Given position points out of the view
+     */
+    K& at(const size_type& m) const
+    {
+        if (!this->has(m))
+            throw std::out_of_range("position is out of range");
+        return this->_data[m * this->_step];
+    }
+
+    /**
+     * Retrieves the element at the given position
+     * (Caution: does not check for bounds)
+     */
+    K& operator[](const size_type& m) const noexcept
+        { return this->_data[m * this->_step]; }
+
+    K& operator()(const size_type& m, const size_type&) const noexcept
+        { return this->_data[m * this->_step]; }
+
+    constexpr shape_type shape() const noexcept
+        { return { this->_size, 1 }; }
+
+    constexpr size_type height() const noexcept
+        { return this->_size; }
+
+    constexpr size_type width() const noexcept
+        { return 1; }
+
+    constexpr size_type size() const noexcept
+        { return this->_size; }
+
+    constexpr size_type step() const noexcept
+        { return this->_step; }
+
+    constexpr bool empty() const noexcept
+        { return !this->_size; }
+
+    constexpr bool has(const size_type& m) const noexcept
+        { return m < this->_size; }
+
+    K * data() const noexcept
+        { return this->_data; }
+
+    /**
+     * Views a contiguous range of the viewed elements
+     *
+     * @param start                 First element of the range
+     * @param count                 Amount of elements
+     * @return                      View over the range
+     *
+     * @exception std::out_of_range Range does not fit within the view
+     */
+    VectorView segment(const size_type& start, const size_type& count) const
+    {
+        if (start > this->_size || count > this->_size - start)
+            throw std::out_of_range("segment is out of range");
+        return VectorView(this->_data + start * this->_step, count, this->_step);
+    }
+
+    /**
+     * Calculates the dot product with another vector or view, accumulated in R
+     * (e.g. `dot<double>` on floats, keeping long sums accurate). Without R,
+     * sums are taken in vector registers and in parallel for large vectors
+     *
+     * @exception std::logic_error  Given vector is of different size
+     */
+    template < class R = value_type >
+    R dot(const VectorView<const value_type>& other) const
+    {
+        if (this->_size != other.size())
+            throw std::logic_error("cannot operate with different matrix sizes");
+        if (std::is_same<R, value_type>::value)
+            return static_cast<R>(maths::blas::dot(this->_size, this->_data, this->_step, other.data(), other.step()));
+        R result = R();
+        for (size_type i = 0; i < this->_size; ++i)
+            result = maths::fma(static_cast<R>((*this)[i]), static_cast<R>(other[i]), result);
+        return result;
+    }
+
+    /**
+     * Calculate the 1-norm (Taxicab norm) of the viewed elements
+     */
+    double norm_1() const
+        { return static_cast<double>(maths::blas::asum(this->_size, this->_data, this->_step)); }
+
+    /**
+     * Calculates the 2-norm (Euclidean norm) of the viewed elements,
+     * without overflowing on large values
+     */
+    double norm_2() const
+        { return static_cast<double>(maths::blas::nrm2(this->_size, this->_data, this->_step)); }
+
+    /**
+     * Calculates the inf-norm (Supremum norm) of the viewed elements
+     */
+    double norm_inf() const
+        { return static_cast<double>(maths::blas::amax(this->_size, this->_data, this->_step)); }
+
+private:
+    /**
+     * Evaluates another operand into the view, element by element
+     *
+     * @exception std::logic_error  Given operand is of different size
+     */
+    template < class T, class Op >
+    VectorView& _write(const T& rhs, const Op& op)
+    {
+        static_assert(!std::is_const<K>::value, "cannot write through a read-only view");
+        const maths::expr::node<T> value(rhs);
+        if (value.height() != this->_size || value.width() != 1)
+            throw std::logic_error("cannot operate with different matrix sizes");
+        maths::expr::evaluate(value, this->_data, this->_step, op);
+        return *this;
+    }
+
+    K *         _data;  // First viewed element
+    size_type   _size;  // Amount of elements
+    size_type   _step;  // Distance between elements
+};
+
+/**
+ * Writes the viewed values on the given output stream
+ */
+template < class K >
+std::ostream& operator<<(std::ostream& out, const VectorView<K>& value)
+    { return out << Vector<typename VectorView<K>::value_type>(value); }
+
+#endif //VECTORVIEW_HPP
@@ -0,0 +1,239 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - bareiss.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [10:40 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef BAREISS_HPP
+#define BAREISS_HPP
+
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "ThreadPool.hpp"
+
+// 128-bit products for 64-bit integers, unless disabled by defining MATRIX_NO_INT128
+#if defined(__SIZEOF_INT128__) && !defined(MATRIX_NO_INT128)
+# define MATRIX_INT128 1
+#endif
+
+/**
+ * Fraction-free (Bareiss) elimination of integer matrices, stored row-major
+ * in raw arrays. Every value produced is a minor of the original matrix, so
+ * each step `(pivot * a - factor * b) / previous` divides exactly: results
+ * are exact, in O(n^3), for as long as those minors fit in the element type.
+ * Products are carried in a wider type (see maths::bareiss::wide), and
+ * any result that does not fit throws std::overflow_error
+ */
+namespace maths
+{
+namespace bareiss
+{
+#ifdef MATRIX_INT128
+    __extension__ typedef __int128 int128;
+#endif
+
+    /**
+     * Type in which the products of an elimination step are calculated:
+     * integers narrower than 64 bits are widened to long long, and 64-bit
+     * integers to 128 bits when available, otherwise kept as is
+     */
+    template < class T >
+    struct wide
+    {
+#ifdef MATRIX_INT128
+        using type = typename std::conditional<(sizeof(T) < sizeof(long long)), long long, int128>::type;
+#else
+        using type = typename std::conditional<(sizeof(T) < sizeof(long long)), long long, T>::type;
+#endif
+    };
+
+    /**
+     * Narrows a result of the wide type back into T
+     *
+     * @exception std::overflow_error Value does not fit in T
+     */
+    template < class T, class W >
+    T narrow(const W& value)
+    {
+        if (value < static_cast<W>(std::numeric_limits<T>::min())
+         || value > static_cast<W>(std::numeric_limits<T>::max()))
+            throw std::overflow_error("integer overflow in fraction-free elimination");
+        return static_cast<T>(value);
+    }
+
+    /**
+     * Divides exactly in the wide type, through 64-bit divisions
+     * when the dividend fits in them
+     */
+    template < class W >
+    W divide(const W& value, const W& divisor)
+        { return value / divisor; }
+
+#ifdef MATRIX_INT128
+    inline int128 divide(const int128& value, const int128& divisor)
+    {
+        constexpr long long low = std::numeric_limits<long long>::min();
+        constexpr long long high = std::numeric_limits<long long>::max();
+        if (value > low && value <= high && divisor > low && divisor <= high)
+            return static_cast<long long>(value) / static_cast<long long>(divisor);
+        return value / divisor;
+    }
+#endif
+
+    /**
+     * Calculates one step of the elimination, `(pivot * value - factor * above) / previous`
+     *
+     * @exception std::overflow_error Result does not fit in T
+     */
+    template < class T >
+    T combine(const T& pivot, const T& value, const T& factor, const T& above, const T& previous)
+    {
+        using W = typename wide<T>::type;
+        W left, right, result;
+        if (__builtin_mul_overflow(static_cast<W>(pivot), static_cast<W>(value), &left)
+         || __builtin_mul_overflow(static_cast<W>(factor), static_cast<W>(above), &right)
+         || __builtin_sub_overflow(left, right, &result))
+            throw std::overflow_error("integer overflow in fraction-free elimination");
+        return narrow<T>(divide(result, static_cast<W>(previous)));
+    }
+
+    /**
+     * Eliminates a matrix in place, column by column, swapping a non-zero pivot
+     * into place when needed. Rows below each pivot are cleared, and with
+     * `reduce` the rows above as well (fraction-free Gauss-Jordan), which
+     * leaves every pivot equal to the last one
+     *
+     * @param a                     Matrix to eliminate
+     * @param height                Amount of rows
+     * @param width                 Amount of columns
+     * @param lda                   Distance between two rows of `a`
+     * @param reduce                Whether to clear above the pivots too
+     * @param odd                   Set to whether an odd amount of rows were swapped
+     * @return                      Rank, the amount of pivots (the leading rows)
+     *
+     * @exception std::overflow_error A minor does not fit in T
+     */
+    template < class T >
+    size_t eliminate(T * a, const size_t& height, const size_t& width, const size_t& lda,
+                     const bool& reduce, bool& odd)
+    {
+        T previous = T(1);
+        size_t rank = 0;
+        odd = false;
+        for (size_t c = 0; c < width && rank < height; ++c)
+        {
+            size_t found = rank;
+            while (found < height && a[found * lda + c] == T())
+                ++found;
+            if (found == height)
+                continue;
+            if (found != rank)
+            {
+                std::swap_ranges(a + found * lda, a + found * lda + width, a + rank * lda);
+                odd = !odd;
+            }
+
+            const T * row = a + rank * lda;
+            const T pivot = row[c];
+            const size_t r = rank;
+            const auto update = [&](const size_t& first, const size_t& last) {
+                for (size_t i = first; i < last; ++i)
+                {
+                    if (i == r)
+                        continue;
+                    T * target = a + i * lda;
+                    const T factor = target[c];
+                    for (size_t j = i < r ? 0 : c + 1; j < width; ++j)
+                        if (j != c)
+                            target[j] = combine(pivot, target[j], factor, row[j], previous);
+                    target[c] = T();
+                }
+            };
+            ThreadPool::global().parallel_rows(reduce ? 0 : r + 1, height, width - c, update);
+            previous = pivot;
+            ++rank;
+        }
+        return rank;
+    }
+
+    /**
+     * Calculates the determinant of a square matrix, eliminating it in place:
+     * the last pivot of Bareiss' elimination is the determinant itself
+     *
+     * @exception std::overflow_error A minor does not fit in T
+     */
+    template < class T >
+    T determinant(T * a, const size_t& size, const size_t& lda)
+    {
+        if (!size)
+            return T(1);
+        bool odd;
+        if (eliminate(a, size, size, lda, false, odd) < size)
+            return T();
+        const T last = a[(size - 1) * lda + size - 1];
+        if (!odd)
+            return last;
+        using W = typename wide<T>::type;
+        return narrow<T>(-static_cast<W>(last));
+    }
+
+    /**
+     * Greatest common divisor of two magnitudes
+     */
+    template < class T >
+    T gcd(T a, T b)
+    {
+        while (b != T())
+        {
+            const T rest = a % b;
+            a = b;
+            b = rest;
+        }
+        return a;
+    }
+
+    /**
+     * Reduces a matrix in place to its fraction-free reduced row echelon form:
+     * pivot columns are cleared but for their pivot, and every row is divided
+     * by the greatest common divisor of its elements, with a positive pivot.
+     * Rows of the reduced row echelon form which are integral are thus exactly
+     * found back, the others being their smallest integer multiple
+     *
+     * @return                      Rank, the amount of non-zero rows (the leading ones)
+     *
+     * @exception std::overflow_error A minor does not fit in T
+     */
+    template < class T >
+    size_t row_echelon(T * a, const size_t& height, const size_t& width, const size_t& lda)
+    {
+        bool odd;
+        const size_t rank = eliminate(a, height, width, lda, true, odd);
+        for (size_t i = 0; i < rank; ++i)
+        {
+            T * row = a + i * lda;
+            T divisor = T();
+            bool negative = false;
+            for (size_t j = 0; j < width; ++j)
+                if (row[j] != T())
+                {
+                    if (divisor == T())
+                        negative = row[j] < T();
+                    divisor = gcd(divisor, row[j] < T() ? T(T() - row[j]) : row[j]);
+                }
+            for (size_t j = 0; j < width; ++j)
+                row[j] = negative ? T(T() - row[j] / divisor) : T(row[j] / divisor);
+        }
+        return rank;
+    }
+}
+}
+
+#endif //BAREISS_HPP
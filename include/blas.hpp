@@ -0,0 +1,434 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - blas.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [8:40 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef BLAS_HPP
+#define BLAS_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "general.hpp"
+#include "simd.hpp"
+#include "ThreadPool.hpp"
+
+namespace maths
+{
+namespace blas
+{
+    // Amount of elements under which reductions stay on a single thread
+    constexpr size_t PARALLEL_THRESHOLD = 1024 * 1024;
+
+    // Amount of elements reduced by each task of a parallel reduction. Large inputs
+    // are always split the same way, so results do not depend on the amount of threads
+    constexpr size_t CHUNK = 256 * 1024;
+
+    // Amount of elements accumulated in vector registers before being added to
+    // the total in the accumulator type, which bounds the rounding errors of floats
+    constexpr size_t BLOCK = 1024;
+
+    /**
+     * Element-wise terms of the additive reductions, taken in the accumulator type W
+     */
+    namespace op
+    {
+        struct dot
+        {
+            template < class W, class T >
+            static W apply(const T& x, const T& y)
+                { return static_cast<W>(x) * static_cast<W>(y); }
+        };
+
+        struct sum
+        {
+            template < class W, class T >
+            static W apply(const T& x, const T&)
+                { return static_cast<W>(x); }
+        };
+
+        struct asum
+        {
+            template < class W, class T >
+            static W apply(const T& x, const T&)
+                { return static_cast<W>(x < T() ? -x : x); }
+        };
+
+        struct square
+        {
+            template < class W, class T >
+            static W apply(const T& x, const T&)
+                { return static_cast<W>(x) * static_cast<W>(x); }
+        };
+    }
+
+    /**
+     * Sums the terms of O over n (possibly strided) elements,
+     * in 4 independent accumulators
+     */
+    template < class O, class T >
+    typename maths::accumulator<T>::type reduce_scalar(const T* x, size_t incx, const T* y, size_t incy, size_t n)
+    {
+        using W = typename maths::accumulator<T>::type;
+        W a0 = W(), a1 = W(), a2 = W(), a3 = W();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            a0 += O::template apply<W>(x[i * incx], y[i * incy]);
+            a1 += O::template apply<W>(x[(i + 1) * incx], y[(i + 1) * incy]);
+            a2 += O::template apply<W>(x[(i + 2) * incx], y[(i + 2) * incy]);
+            a3 += O::template apply<W>(x[(i + 3) * incx], y[(i + 3) * incy]);
+        }
+        for (; i < n; ++i)
+            a0 += O::template apply<W>(x[i * incx], y[i * incy]);
+        return (a0 + a1) + (a2 + a3);
+    }
+
+    template < class O, class T >
+    typename maths::accumulator<T>::type reduce_plain(const T* x, const T* y, size_t n)
+        { return reduce_scalar<O>(x, 1, y, 1, n); }
+
+    /**
+     * Retrieves the largest magnitude among n (possibly strided) elements
+     */
+    template < class T >
+    T amax_scalar(const T* x, size_t incx, size_t n)
+    {
+        T result = T();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const T value = x[i * incx] < T() ? -x[i * incx] : x[i * incx];
+            if (result < value)
+                result = value;
+        }
+        return result;
+    }
+
+    template < class T >
+    T amax_plain(const T* x, size_t n)
+        { return amax_scalar(x, 1, n); }
+
+    /**
+     * Reduction loops of a vector instruction set, over a pack P: 4 packs of
+     * accumulators hide the latency of the additions, and are flushed into the
+     * wide total every BLOCK elements
+     */
+    template < maths::simd::isa I >
+    struct loops;
+
+#ifdef MATRIX_X86
+# define MATRIX_BLAS_LOOPS(NAME, TARGET) \
+    template <> \
+    struct loops<maths::simd::isa::NAME> \
+    { \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static typename P::type step(const op::dot&, typename P::type acc, const T* x, const T* y) \
+            { return P::add(acc, P::mul(P::load(x), P::load(y))); } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static typename P::type step(const op::sum&, typename P::type acc, const T* x, const T*) \
+            { return P::add(acc, P::load(x)); } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static typename P::type step(const op::asum&, typename P::type acc, const T* x, const T*) \
+            { return P::add(acc, P::abs(P::load(x))); } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static typename P::type step(const op::square&, typename P::type acc, const T* x, const T*) \
+        { \
+            const typename P::type value = P::load(x); \
+            return P::add(acc, P::mul(value, value)); \
+        } \
+        template < class P, class O, class T > __attribute__((target(TARGET))) \
+        static typename maths::accumulator<T>::type reduce(const T* x, const T* y, size_t n) \
+        { \
+            using W = typename maths::accumulator<T>::type; \
+            constexpr size_t W4 = 4 * P::width; \
+            W total = W(); \
+            T lanes[P::width]; \
+            size_t i = 0; \
+            while (i + W4 <= n) \
+            { \
+                const size_t end = i + std::min(BLOCK, n - i) / W4 * W4; \
+                typename P::type a0 = P::set1(T()), a1 = a0, a2 = a0, a3 = a0; \
+                for (; i < end; i += W4) \
+                { \
+                    a0 = step<P>(O(), a0, x + i, y + i); \
+                    a1 = step<P>(O(), a1, x + i + P::width, y + i + P::width); \
+                    a2 = step<P>(O(), a2, x + i + 2 * P::width, y + i + 2 * P::width); \
+                    a3 = step<P>(O(), a3, x + i + 3 * P::width, y + i + 3 * P::width); \
+                } \
+                P::store(lanes, P::add(P::add(a0, a1), P::add(a2, a3))); \
+                for (size_t l = 0; l < P::width; ++l) \
+                    total += static_cast<W>(lanes[l]); \
+            } \
+            return total + reduce_scalar<O>(x + i, 1, y + i, 1, n - i); \
+        } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static T amax(const T* x, size_t n) \
+        { \
+            constexpr size_t W4 = 4 * P::width; \
+            typename P::type m0 = P::set1(T()), m1 = m0, m2 = m0, m3 = m0; \
+            size_t i = 0; \
+            for (; i + W4 <= n; i += W4) \
+            { \
+                m0 = P::max(m0, P::abs(P::load(x + i))); \
+                m1 = P::max(m1, P::abs(P::load(x + i + P::width))); \
+                m2 = P::max(m2, P::abs(P::load(x + i + 2 * P::width))); \
+                m3 = P::max(m3, P::abs(P::load(x + i + 3 * P::width))); \
+            } \
+            T lanes[P::width]; \
+            P::store(lanes, P::max(P::max(m0, m1), P::max(m2, m3))); \
+            T result = amax_scalar(x + i, 1, n - i); \
+            for (size_t l = 0; l < P::width; ++l) \
+                result = std::max(result, lanes[l]); \
+            return result; \
+        } \
+    };
+
+    MATRIX_SIMD_TARGETS(MATRIX_BLAS_LOOPS)
+# undef MATRIX_BLAS_LOOPS
+#endif
+
+    /**
+     * Table of contiguous reduction kernels for a floating-point type (see
+     * table() for the one of the running CPU)
+     *
+     * @tparam T    Element type
+     */
+    template < class T >
+    struct kernels
+    {
+        using wide_type = typename maths::accumulator<T>::type;
+        using reduce_type = wide_type (*)(const T*, const T*, size_t);
+
+        reduce_type dot                 = reduce_plain<op::dot, T>;
+        reduce_type sum                 = reduce_plain<op::sum, T>;
+        reduce_type asum                = reduce_plain<op::asum, T>;
+        reduce_type square              = reduce_plain<op::square, T>;
+        T (*amax)(const T*, size_t)     = amax_plain<T>;
+
+        /**
+         * Constructs the table of the plain loops
+         */
+        kernels() noexcept = default;
+
+        explicit kernels(maths::simd::isa_tag<maths::simd::isa::scalar>) noexcept {}
+
+        /**
+         * Constructs the table of a vector instruction set
+         */
+        template < maths::simd::isa I >
+        explicit kernels(maths::simd::isa_tag<I>) noexcept:
+            dot(&loops<I>::template reduce<maths::simd::pack<T, I>, op::dot, T>),
+            sum(&loops<I>::template reduce<maths::simd::pack<T, I>, op::sum, T>),
+            asum(&loops<I>::template reduce<maths::simd::pack<T, I>, op::asum, T>),
+            square(&loops<I>::template reduce<maths::simd::pack<T, I>, op::square, T>),
+            amax(&loops<I>::template amax<maths::simd::pack<T, I>, T>)
+        {}
+    };
+
+    /**
+     * Retrieves the kernels table of the given type, selected on first use
+     *
+     * @return                      Kernels table
+     */
+    template < class T >
+    const kernels<T>& table() noexcept
+    {
+        static const kernels<T> value = maths::simd::dispatch(maths::simd::construct<kernels<T>>());
+        return value;
+    }
+
+    // Whether T goes through the dispatched kernels or the plain loops
+    // (floating-point types only, whose packs can take maximums)
+    template < class T >
+    using vectorized = std::integral_constant<bool, std::is_floating_point<T>::value
+        && maths::simd::lane_of<T>::value != maths::simd::lane::none>;
+
+    template < class O, class T >
+    typename maths::accumulator<T>::type contiguous(const T* x, const T* y, const size_t& n, std::false_type)
+        { return reduce_plain<O>(x, y, n); }
+
+    template < class O, class T >
+    typename maths::accumulator<T>::type contiguous(const T* x, const T* y, const size_t& n, std::true_type)
+    {
+        const kernels<T>& k = table<T>();
+        return (std::is_same<O, op::dot>::value ? k.dot : std::is_same<O, op::sum>::value ? k.sum
+              : std::is_same<O, op::asum>::value ? k.asum : k.square)(x, y, n);
+    }
+
+    template < class T >
+    T amax_contiguous(const T* x, const size_t& n, std::false_type)
+        { return amax_plain(x, n); }
+
+    template < class T >
+    T amax_contiguous(const T* x, const size_t& n, std::true_type)
+        { return table<T>().amax(x, n); }
+
+    /**
+     * Runs `body(first, last)` over the whole range of n elements, or over chunks of
+     * CHUNK elements in parallel for large inputs, then joins the partial results
+     * in order with `join(lhs, rhs)`
+     */
+    template < class R, class F, class J >
+    R split(const size_t& n, const F& body, const J& join)
+    {
+        if (n < PARALLEL_THRESHOLD)
+            return body(size_t(0), n);
+        const size_t count = (n + CHUNK - 1) / CHUNK;
+        std::vector<R> partial(count);
+        ThreadPool::global().parallel_for(count, [&](const size_t& c) {
+            partial[c] = body(c * CHUNK, std::min(n, (c + 1) * CHUNK));
+        });
+        R result = partial[0];
+        for (size_t c = 1; c < count; ++c)
+            result = join(result, partial[c]);
+        return result;
+    }
+
+    /**
+     * Sums the terms of O over n elements, vectorized when contiguous
+     */
+    template < class O, class T >
+    typename maths::accumulator<T>::type reduce(const size_t& n, const T* x, const size_t& incx,
+                                                const T* y, const size_t& incy)
+    {
+        using W = typename maths::accumulator<T>::type;
+        return split<W>(n, [&](const size_t& first, const size_t& last) {
+            if (incx == 1 && incy == 1)
+                return contiguous<O>(x + first, y + first, last - first, vectorized<T>());
+            return reduce_scalar<O>(x + first * incx, incx, y + first * incy, incy, last - first);
+        }, [](const W& lhs, const W& rhs) { return lhs + rhs; });
+    }
+
+    /**
+     * Calculates the dot product of two vectors of n elements (dot),
+     * accumulated in the accumulator type of T
+     *
+     * @param n                     Amount of elements
+     * @param x                     First vector
+     * @param incx                  Distance between two elements of x
+     * @param y                     Second vector
+     * @param incy                  Distance between two elements of y
+     */
+    template < class T >
+    typename maths::accumulator<T>::type dot(const size_t& n, const T* x, const size_t& incx,
+                                             const T* y, const size_t& incy)
+        { return reduce<op::dot>(n, x, incx, y, incy); }
+
+    /**
+     * Calculates the sum of n elements, accumulated in the accumulator type of T
+     */
+    template < class T >
+    typename maths::accumulator<T>::type sum(const size_t& n, const T* x, const size_t& incx)
+        { return reduce<op::sum>(n, x, incx, x, incx); }
+
+    /**
+     * Calculates the sum of the magnitudes of n elements (asum),
+     * accumulated in the accumulator type of T
+     */
+    template < class T >
+    typename maths::accumulator<T>::type asum(const size_t& n, const T* x, const size_t& incx)
+        { return reduce<op::asum>(n, x, incx, x, incx); }
+
+    /**
+     * Retrieves the largest magnitude among n elements
+     */
+    template < class T >
+    T amax(const size_t& n, const T* x, const size_t& incx)
+    {
+        return split<T>(n, [&](const size_t& first, const size_t& last) {
+            if (incx == 1)
+                return amax_contiguous(x + first, last - first, vectorized<T>());
+            return amax_scalar(x + first * incx, incx, last - first);
+        }, [](const T& lhs, const T& rhs) { return lhs < rhs ? rhs : lhs; });
+    }
+
+    /**
+     * Retrieves the position of the first element of largest magnitude (iamax),
+     * 0 when there are none. Maximums are found block by block, then only
+     * the block holding the largest one is searched again
+     */
+    template < class T >
+    size_t iamax(const size_t& n, const T* x, const size_t& incx)
+    {
+        using found = std::pair<size_t, T>;
+        const auto search = [&](const size_t& first, const size_t& last) {
+            found best(first, T());
+            for (size_t start = first; start < last; start += BLOCK)
+            {
+                const size_t count = std::min(BLOCK, last - start);
+                const T value = incx == 1 ? amax_contiguous(x + start, count, vectorized<T>())
+                                          : amax_scalar(x + start * incx, incx, count);
+                if (start == first || best.second < value)
+                    best = found(start, value);
+            }
+            for (size_t i = best.first; i < std::min(best.first + BLOCK, last); ++i)
+            {
+                const T value = x[i * incx] < T() ? -x[i * incx] : x[i * incx];
+                if (value == best.second)
+                    return found(i, value);
+            }
+            return best;
+        };
+        if (!n)
+            return 0;
+        return split<found>(n, search, [](const found& lhs, const found& rhs) {
+            return lhs.second < rhs.second ? rhs : lhs;
+        }).first;
+    }
+
+    template < class T, class W >
+    auto finish_nrm2(const W& squares, const size_t&, const T*, const size_t&, std::false_type)
+        -> decltype(std::sqrt(W()))
+        { return std::sqrt(squares); }
+
+    /**
+     * Retrieves the square root of a sum of squares, unless it overflowed or may
+     * have lost tiny squares to underflow, in which case the norm is calculated
+     * again over values scaled by the largest magnitude
+     */
+    template < class T, class W >
+    auto finish_nrm2(const W& squares, const size_t& n, const T* x, const size_t& incx, std::true_type)
+        -> decltype(std::sqrt(W()))
+    {
+        using N = decltype(std::sqrt(W()));
+        const W tiny = static_cast<W>(std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon());
+        if (!(squares < tiny) && !(squares > std::numeric_limits<W>::max()))
+            return std::sqrt(squares);
+
+        const T largest = amax(n, x, incx);
+        if (largest == T() || !(largest <= std::numeric_limits<T>::max()))
+            return static_cast<N>(largest);
+        W total = W();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const W value = static_cast<W>(x[i * incx]) / static_cast<W>(largest);
+            total += value * value;
+        }
+        return static_cast<N>(static_cast<W>(largest) * std::sqrt(total));
+    }
+
+    /**
+     * Calculates the euclidean norm of n elements (nrm2), summing the squares
+     * in a single pass, without overflowing nor underflowing
+     */
+    template < class T >
+    auto nrm2(const size_t& n, const T* x, const size_t& incx)
+        -> decltype(std::sqrt(typename maths::accumulator<T>::type()))
+    {
+        using W = typename maths::accumulator<T>::type;
+        return finish_nrm2(reduce<op::square>(n, x, incx, x, incx), n, x, incx,
+                           std::is_floating_point<W>());
+    }
+}
+}
+
+#endif //BLAS_HPP
@@ -0,0 +1,202 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - exact.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [11:40 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef EXACT_HPP
+#define EXACT_HPP
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include "gemm.hpp"
+#include "Arena.hpp"
+
+/**
+ * Elimination of matrices over exact fields (such as integers modulo a prime,
+ * see Modular), stored row-major in raw arrays. Without rounding errors, any
+ * non-zero pivot will do: each pivot row costs a single inverse, the rows of
+ * a panel are eliminated with multiplications only, and the trailing matrix
+ * is updated once per panel through the GEMM engine, where element types may
+ * accumulate their own way (such as reducing lazily)
+ */
+namespace maths
+{
+namespace exact
+{
+    // Width of the panels of columns eliminated before updating the trailing matrix
+    constexpr size_t BLOCK = 64;
+
+    /**
+     * Eliminates a matrix in place into a row echelon form, column by column,
+     * swapping a non-zero pivot into place when needed: the leading rows hold
+     * the pivots, with zeros below them and on the rows left
+     *
+     * @param a                     Matrix to eliminate
+     * @param height                Amount of rows
+     * @param width                 Amount of columns
+     * @param lda                   Distance between two rows of `a`
+     * @param columns               Receives the column of every pivot, in order
+     * @param odd                   Set to whether an odd amount of rows were swapped
+     * @return                      Rank, the amount of pivots
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    size_t eliminate(K * a, const size_t& height, const size_t& width, const size_t& lda,
+                     std::vector<size_t>& columns, bool& odd)
+    {
+        size_t rank = 0;
+        odd = false;
+        columns.clear();
+        maths::Scratch<K> lower(height * (width < BLOCK ? width : BLOCK));
+
+        for (size_t start = 0; start < width && rank < height; start += BLOCK)
+        {
+            const size_t end = width - start < BLOCK ? width : start + BLOCK;
+            const size_t first = rank;
+
+            // Panel, storing the multipliers in place of the eliminated values
+            for (size_t c = start; c < end && rank < height; ++c)
+            {
+                size_t found = rank;
+                while (found < height && a[found * lda + c] == K())
+                    ++found;
+                if (found == height)
+                    continue;
+                if (found != rank)
+                {
+                    std::swap_ranges(a + found * lda, a + found * lda + width, a + rank * lda);
+                    odd = !odd;
+                }
+
+                const K * row = a + rank * lda;
+                const K inverse = K(1) / row[c];
+                for (size_t i = rank + 1; i < height; ++i)
+                {
+                    K * target = a + i * lda;
+                    if (target[c] == K())
+                        continue;
+                    const K factor = target[c] *= inverse;
+                    for (size_t j = c + 1; j < end; ++j)
+                        target[j] -= factor * row[j];
+                }
+                columns.push_back(c);
+                ++rank;
+            }
+
+            const size_t kb = rank - first;
+            if (kb && end < width)
+            {
+                // U12 = inverse(L11) * A12
+                for (size_t t = first + 1; t < rank; ++t)
+                    for (size_t s = first; s < t; ++s)
+                    {
+                        const K factor = a[t * lda + columns[s]];
+                        if (factor == K())
+                            continue;
+                        for (size_t j = end; j < width; ++j)
+                            a[t * lda + j] -= factor * a[s * lda + j];
+                    }
+
+                // A22 -= L21 * U12
+                const size_t rest = height - rank;
+                for (size_t i = 0; i < rest; ++i)
+                    for (size_t s = 0; s < kb; ++s)
+                        lower[i * kb + s] = -a[(rank + i) * lda + columns[first + s]];
+                maths::gemm::multiply(rest, width - end, kb,
+                                      lower.get(), kb,
+                                      a + first * lda + end, lda,
+                                      a + rank * lda + end, lda);
+            }
+
+            // Multipliers are no longer needed
+            for (size_t s = first; s < rank; ++s)
+                for (size_t i = s + 1; i < height; ++i)
+                    a[i * lda + columns[s]] = K();
+        }
+        return rank;
+    }
+
+    /**
+     * Calculates the determinant of a square matrix, eliminating it in place,
+     * as the signed product of the pivots
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    K determinant(K * a, const size_t& size, const size_t& lda)
+    {
+        std::vector<size_t> columns;
+        bool odd;
+        if (eliminate(a, size, size, lda, columns, odd) < size)
+            return K();
+        K result = K(1);
+        for (size_t i = 0; i < size; ++i)
+            result *= a[i * lda + i];
+        return odd ? -result : result;
+    }
+
+    /**
+     * Reduces a matrix in place to its reduced row echelon form: pivot rows
+     * are scaled by a single inverse each, then cleared above their pivots
+     * from the bottom on, by blocks of rows updated through the GEMM engine
+     * with the rows below them, which are final already
+     *
+     * @return                      Rank, the amount of non-zero rows (the leading ones)
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K >
+    size_t row_echelon(K * a, const size_t& height, const size_t& width, const size_t& lda)
+    {
+        std::vector<size_t> columns;
+        bool odd;
+        const size_t rank = eliminate(a, height, width, lda, columns, odd);
+
+        for (size_t i = 0; i < rank; ++i)
+        {
+            K * row = a + i * lda;
+            const K inverse = K(1) / row[columns[i]];
+            for (size_t j = columns[i]; j < width; ++j)
+                row[j] *= inverse;
+        }
+
+        for (size_t end = rank, start; end; end = start)
+        {
+            start = end < BLOCK ? 0 : end - BLOCK;
+            const size_t below = rank - end;
+            if (below)
+            {
+                // Pivot columns of the rows below cancel out exactly
+                maths::Scratch<K> factors((end - start) * below);
+                for (size_t i = 0; i < end - start; ++i)
+                    for (size_t k = 0; k < below; ++k)
+                        factors[i * below + k] = -a[(start + i) * lda + columns[end + k]];
+                maths::gemm::multiply(end - start, width, below,
+                                      factors.get(), below,
+                                      a + end * lda, lda,
+                                      a + start * lda, lda);
+            }
+            for (size_t i = end; i-- > start;)
+                for (size_t k = i + 1; k < end; ++k)
+                {
+                    const K factor = a[i * lda + columns[k]];
+                    if (factor == K())
+                        continue;
+                    for (size_t j = columns[k]; j < width; ++j)
+                        a[i * lda + j] -= factor * a[k * lda + j];
+                }
+        }
+        return rank;
+    }
+}
+}
+
+#endif //EXACT_HPP
@@ -0,0 +1,414 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - gemm.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [9:12 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef GEMM_HPP
+#define GEMM_HPP
+
+#include <algorithm>
+#include "general.hpp"
+#include "simd.hpp"
+#include "ThreadPool.hpp"
+#include "Arena.hpp"
+
+namespace maths
+{
+namespace gemm
+{
+    // Amount of multiply-adds under which products stay on a single thread
+    constexpr size_t PARALLEL_THRESHOLD = 64 * 64 * 64;
+
+    /**
+     * Blocking parameters of the multiplication engine, for a given type.
+     * `MR` x `NR` is the register tile computed by the micro-kernel,
+     * `KC` x `NR` panels of B are meant to stay in L1, `MC` x `KC` blocks of A
+     * in L2, and `KC` x `NC` blocks of B in L3
+     *
+     * @tparam T    Element type
+     */
+    template < class T >
+    struct blocking
+    {
+        static constexpr size_t MR = 4;
+        static constexpr size_t NR = 4;
+        static constexpr size_t KC = 256;
+        static constexpr size_t MC = 64;
+        static constexpr size_t NC = 1024;
+    };
+
+    template <>
+    struct blocking<float>
+    {
+        static constexpr size_t MR = 6;
+        static constexpr size_t NR = 16;
+        static constexpr size_t KC = 256;
+        static constexpr size_t MC = 144;
+        static constexpr size_t NC = 4080;
+    };
+
+    template <>
+    struct blocking<double>
+    {
+        static constexpr size_t MR = 6;
+        static constexpr size_t NR = 8;
+        static constexpr size_t KC = 256;
+        static constexpr size_t MC = 72;
+        static constexpr size_t NC = 2040;
+    };
+
+    /**
+     * Checks whether the running CPU can execute the AVX2/FMA micro-kernels
+     *
+     * @return                      TRUE if supported, otherwise FALSE
+     */
+    inline bool has_avx2_fma() noexcept
+        { return simd::level() >= simd::isa::avx2 && simd::has_fma(); }
+
+    /**
+     * Portable micro-kernel, computing C += A * B on a single MR x NR tile
+     * from packed panels
+     *
+     * @param kc                    Depth of the panels
+     * @param a                     Packed A panel (kc columns of MR values)
+     * @param b                     Packed B panel (kc rows of NR values)
+     * @param c                     Top-left corner of the C tile
+     * @param ldc                   Row stride of C
+     */
+    template < class T >
+    void micro_kernel(const size_t& kc, const T* a, const T* b, T* c, const size_t& ldc)
+    {
+        constexpr size_t MR = blocking<T>::MR;
+        constexpr size_t NR = blocking<T>::NR;
+
+        T acc[MR][NR];
+        for (size_t i = 0; i < MR; ++i)
+            for (size_t j = 0; j < NR; ++j)
+                acc[i][j] = T();
+
+        for (size_t p = 0; p < kc; ++p, a += MR, b += NR)
+            for (size_t i = 0; i < MR; ++i)
+            {
+                const T value = a[i];
+                for (size_t j = 0; j < NR; ++j)
+                    acc[i][j] += value * b[j];
+            }
+
+        for (size_t i = 0; i < MR; ++i)
+            for (size_t j = 0; j < NR; ++j)
+                c[i * ldc + j] += acc[i][j];
+    }
+
+#ifdef MATRIX_X86
+    /**
+     * AVX2/FMA micro-kernel for floats, on a 6 x 16 tile (12 accumulators)
+     */
+    __attribute__((target("avx2,fma")))
+    inline void micro_kernel_avx2(const size_t& kc, const float* a, const float* b, float* c, const size_t& ldc)
+    {
+        __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+        __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+        __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+        __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+        __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+        for (size_t p = 0; p < kc; ++p, a += 6, b += 16)
+        {
+            const __m256 b0 = _mm256_loadu_ps(b);
+            const __m256 b1 = _mm256_loadu_ps(b + 8);
+            __m256 v;
+            v = _mm256_broadcast_ss(a + 0); c00 = _mm256_fmadd_ps(v, b0, c00); c01 = _mm256_fmadd_ps(v, b1, c01);
+            v = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(v, b0, c10); c11 = _mm256_fmadd_ps(v, b1, c11);
+            v = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(v, b0, c20); c21 = _mm256_fmadd_ps(v, b1, c21);
+            v = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(v, b0, c30); c31 = _mm256_fmadd_ps(v, b1, c31);
+            v = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(v, b0, c40); c41 = _mm256_fmadd_ps(v, b1, c41);
+            v = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(v, b0, c50); c51 = _mm256_fmadd_ps(v, b1, c51);
+        }
+
+        const __m256 acc[6][2] = { {c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51} };
+        for (size_t i = 0; i < 6; ++i, c += ldc)
+        {
+            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), acc[i][0]));
+            _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), acc[i][1]));
+        }
+    }
+
+    /**
+     * AVX2/FMA micro-kernel for doubles, on a 6 x 8 tile (12 accumulators)
+     */
+    __attribute__((target("avx2,fma")))
+    inline void micro_kernel_avx2(const size_t& kc, const double* a, const double* b, double* c, const size_t& ldc)
+    {
+        __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+        __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+        __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+        __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+        __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+        for (size_t p = 0; p < kc; ++p, a += 6, b += 8)
+        {
+            const __m256d b0 = _mm256_loadu_pd(b);
+            const __m256d b1 = _mm256_loadu_pd(b + 4);
+            __m256d v;
+            v = _mm256_broadcast_sd(a + 0); c00 = _mm256_fmadd_pd(v, b0, c00); c01 = _mm256_fmadd_pd(v, b1, c01);
+            v = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(v, b0, c10); c11 = _mm256_fmadd_pd(v, b1, c11);
+            v = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(v, b0, c20); c21 = _mm256_fmadd_pd(v, b1, c21);
+            v = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(v, b0, c30); c31 = _mm256_fmadd_pd(v, b1, c31);
+            v = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(v, b0, c40); c41 = _mm256_fmadd_pd(v, b1, c41);
+            v = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(v, b0, c50); c51 = _mm256_fmadd_pd(v, b1, c51);
+        }
+
+        const __m256d acc[6][2] = { {c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51} };
+        for (size_t i = 0; i < 6; ++i, c += ldc)
+        {
+            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), acc[i][0]));
+            _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), acc[i][1]));
+        }
+    }
+#endif
+
+    /**
+     * Micro-kernel of the types without a SIMD one. Types with their own
+     * arithmetic specialize it, to accumulate their own way (see Modular)
+     */
+    template < class T >
+    struct portable_kernel
+    {
+        static void run(const size_t& kc, const T* a, const T* b, T* c, const size_t& ldc)
+            { micro_kernel(kc, a, b, c, ldc); }
+    };
+
+    /**
+     * Selects the best micro-kernel available for the given type
+     */
+    template < class T >
+    void dispatch_kernel(const size_t& kc, const T* a, const T* b, T* c, const size_t& ldc)
+        { portable_kernel<T>::run(kc, a, b, c, ldc); }
+
+#ifdef MATRIX_X86
+    template <>
+    inline void dispatch_kernel<float>(const size_t& kc, const float* a, const float* b, float* c, const size_t& ldc)
+    {
+        if (has_avx2_fma())
+            micro_kernel_avx2(kc, a, b, c, ldc);
+        else
+            micro_kernel(kc, a, b, c, ldc);
+    }
+
+    template <>
+    inline void dispatch_kernel<double>(const size_t& kc, const double* a, const double* b, double* c, const size_t& ldc)
+    {
+        if (has_avx2_fma())
+            micro_kernel_avx2(kc, a, b, c, ldc);
+        else
+            micro_kernel(kc, a, b, c, ldc);
+    }
+#endif
+
+    /**
+     * Packs a mc x kc block of A into row panels of MR values,
+     * stored column after column (zero padded on the last panel),
+     * converting the values from S into T
+     */
+    template < class T, class S >
+    void pack_a(const size_t& mc, const size_t& kc, const S* a, const size_t& lda, T* out)
+    {
+        constexpr size_t MR = blocking<T>::MR;
+        for (size_t i = 0; i < mc; i += MR)
+        {
+            const size_t rows = std::min(MR, mc - i);
+            for (size_t p = 0; p < kc; ++p)
+            {
+                size_t r = 0;
+                for (; r < rows; ++r)
+                    *out++ = static_cast<T>(a[(i + r) * lda + p]);
+                for (; r < MR; ++r)
+                    *out++ = T();
+            }
+        }
+    }
+
+    /**
+     * Packs a kc x nc block of B into column panels of NR values,
+     * stored row after row (zero padded on the last panel),
+     * converting the values from S into T
+     */
+    template < class T, class S >
+    void pack_b(const size_t& kc, const size_t& nc, const S* b, const size_t& ldb, T* out)
+    {
+        constexpr size_t NR = blocking<T>::NR;
+        for (size_t j = 0; j < nc; j += NR)
+        {
+            const size_t cols = std::min(NR, nc - j);
+            for (size_t p = 0; p < kc; ++p)
+            {
+                const S* row = b + p * ldb + j;
+                size_t r = 0;
+                for (; r < cols; ++r)
+                    *out++ = static_cast<T>(row[r]);
+                for (; r < NR; ++r)
+                    *out++ = T();
+            }
+        }
+    }
+
+    /**
+     * Runs the micro-kernel over every register tile of a packed block,
+     * going through a temporary tile on the partial edges
+     */
+    template < class T >
+    void macro_kernel(const size_t& mc, const size_t& nc, const size_t& kc,
+                      const T* a, const T* b, T* c, const size_t& ldc)
+    {
+        constexpr size_t MR = blocking<T>::MR;
+        constexpr size_t NR = blocking<T>::NR;
+        T edge[MR * NR];
+
+        for (size_t j = 0; j < nc; j += NR)
+        {
+            const size_t cols = std::min(NR, nc - j);
+            for (size_t i = 0; i < mc; i += MR)
+            {
+                const size_t rows = std::min(MR, mc - i);
+                const T* pa = a + i * kc;
+                const T* pb = b + j * kc;
+                T* pc = c + i * ldc + j;
+
+                if (rows == MR && cols == NR)
+                {
+                    dispatch_kernel(kc, pa, pb, pc, ldc);
+                    continue;
+                }
+                for (size_t e = 0; e < MR * NR; ++e)
+                    edge[e] = T();
+                dispatch_kernel(kc, pa, pb, edge, NR);
+                for (size_t r = 0; r < rows; ++r)
+                    for (size_t s = 0; s < cols; ++s)
+                        pc[r * ldc + s] += edge[r * NR + s];
+            }
+        }
+    }
+
+    /**
+     * Calculates C += A * B on row-major operands on the current thread, using
+     * packed operands, L1/L2/L3 cache blocking and a register-tiled micro-kernel.
+     * Operands of type S are converted into T while packed, so that narrow
+     * operands may be accumulated in a wider type at their own bandwidth cost
+     *
+     * @param m                     Height of A and C
+     * @param n                     Width of B and C
+     * @param k                     Width of A and height of B
+     * @param a                     A operand
+     * @param lda                   Row stride of A
+     * @param b                     B operand
+     * @param ldb                   Row stride of B
+     * @param c                     C operand, receiving the result
+     * @param ldc                   Row stride of C
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class T, class S >
+    void multiply_serial(const size_t& m, const size_t& n, const size_t& k,
+                         const S* a, const size_t& lda,
+                         const S* b, const size_t& ldb,
+                         T* c, const size_t& ldc)
+    {
+        constexpr size_t MR = blocking<T>::MR;
+        constexpr size_t NR = blocking<T>::NR;
+        constexpr size_t KC = blocking<T>::KC;
+        constexpr size_t MC = blocking<T>::MC;
+        constexpr size_t NC = blocking<T>::NC;
+        if (!m || !n || !k)
+            return;
+
+        const size_t mc_max = std::min(MC, (m + MR - 1) / MR * MR);
+        const size_t nc_max = std::min(NC, (n + NR - 1) / NR * NR);
+        const size_t kc_max = std::min(KC, k);
+        maths::Scratch<T> packed_a(mc_max * kc_max);
+        maths::Scratch<T> packed_b(kc_max * nc_max);
+
+        for (size_t jc = 0; jc < n; jc += NC)
+        {
+            const size_t nc = std::min(NC, n - jc);
+            for (size_t pc = 0; pc < k; pc += KC)
+            {
+                const size_t kc = std::min(KC, k - pc);
+                pack_b(kc, nc, b + pc * ldb + jc, ldb, packed_b.get());
+                for (size_t ic = 0; ic < m; ic += MC)
+                {
+                    const size_t mc = std::min(MC, m - ic);
+                    pack_a(mc, kc, a + ic * lda + pc, lda, packed_a.get());
+                    macro_kernel(mc, nc, kc, packed_a.get(), packed_b.get(), c + ic * ldc + jc, ldc);
+                }
+            }
+        }
+    }
+
+    /**
+     * Calculates C += A * B on row-major operands. Large products are split
+     * into a grid of output tiles, computed in parallel on the shared thread pool.
+     * Operands of type S are accumulated in the type T of C (see multiply_serial)
+     *
+     * @param m                     Height of A and C
+     * @param n                     Width of B and C
+     * @param k                     Width of A and height of B
+     * @param a                     A operand
+     * @param lda                   Row stride of A
+     * @param b                     B operand
+     * @param ldb                   Row stride of B
+     * @param c                     C operand, receiving the result
+     * @param ldc                   Row stride of C
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class T, class S >
+    void multiply(const size_t& m, const size_t& n, const size_t& k,
+                  const S* a, const size_t& lda,
+                  const S* b, const size_t& ldb,
+                  T* c, const size_t& ldc)
+    {
+        constexpr size_t MR = blocking<T>::MR;
+        constexpr size_t NR = blocking<T>::NR;
+        if (!m || !n || !k)
+            return;
+
+        ThreadPool& pool = ThreadPool::global();
+        if (pool.size() == 1 || m * n * k < PARALLEL_THRESHOLD)
+            return multiply_serial(m, n, k, a, lda, b, ldb, c, ldc);
+
+        // Aims for a few tiles per thread, while keeping them large enough
+        // for the packing of B to stay negligible
+        const size_t target = pool.size() * 4;
+        size_t rows = std::min(target, std::max<size_t>(1, m / (MR * 8)));
+        size_t cols = std::min((target + rows - 1) / rows, std::max<size_t>(1, n / (NR * 8)));
+        const size_t tile_m = ((m + rows - 1) / rows + MR - 1) / MR * MR;
+        const size_t tile_n = ((n + cols - 1) / cols + NR - 1) / NR * NR;
+        rows = (m + tile_m - 1) / tile_m;
+        cols = (n + tile_n - 1) / tile_n;
+
+        pool.parallel_for(rows * cols, [&](const size_t& tile) {
+            const size_t i = tile / cols * tile_m;
+            const size_t j = tile % cols * tile_n;
+            multiply_serial(std::min(tile_m, m - i), std::min(tile_n, n - j), k,
+                            a + i * lda, lda, b + j, ldb, c + i * ldc + j, ldc);
+        });
+    }
+
+    /**
+     * Retrieves the amount of floating-point operations of a m x k by k x n product,
+     * useful for reporting GFLOPS
+     */
+    constexpr double flops(const size_t& m, const size_t& n, const size_t& k) noexcept
+        { return 2. * static_cast<double>(m) * static_cast<double>(n) * static_cast<double>(k); }
+}
+}
+
+#endif //GEMM_HPP
@@ -13,7 +13,9 @@
 #define GENERAL_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
+#include <type_traits>
 
 namespace maths
 {
@@ -31,6 +33,80 @@ namespace maths
     auto fma(const X& base, const Y& mul, const Z& add) -> decltype(base * mul + add)
         { return base * mul + add; }
 
+    // Whether divisions are exact on T (making it a field), which
+    // allows algorithms based on elimination such as the LU factorization
+    template < class T >
+    struct is_field: std::integral_constant<bool, !std::is_integral<T>::value> {};
+
+    // Kinds of elimination, chosen by the arithmetic of the elements: rounded
+    // (pivots chosen by magnitude, against rounding errors), fraction-free
+    // (exact divisions of integers), or exact (fields without rounding errors,
+    // such as integers modulo a prime, where any non-zero pivot will do)
+    namespace elimination
+    {
+        struct rounded {};
+        struct fraction_free {};
+        struct exact {};
+    }
+
+    // Kind of elimination suited to T, specialized by exact field types (see Modular)
+    template < class T >
+    struct elimination_of
+    {
+        using type = typename std::conditional<std::is_integral<T>::value,
+            elimination::fraction_free, elimination::rounded>::type;
+    };
+
+    // Type in which sums and eliminations over T are accumulated,
+    // wider than T when rounding errors would otherwise pile up
+    template < class T >
+    struct accumulator { using type = T; };
+
+    template <>
+    struct accumulator<float> { using type = double; };
+
+    // Compile-time sequence of indices, for unrolling over packs (std::index_sequence is C++14)
+    template < size_t... I >
+    struct indices {};
+
+    template < class A, class B >
+    struct concat_indices;
+
+    template < size_t... I, size_t... J >
+    struct concat_indices<indices<I...>, indices<J...>>
+        { using type = indices<I..., (sizeof...(I) + J)...>; };
+
+    // Builds indices<0, ..., N - 1>, in a logarithmic instantiation depth
+    template < size_t N >
+    struct make_indices
+    {
+        using type = typename concat_indices<typename make_indices<N / 2>::type,
+                                             typename make_indices<N - N / 2>::type>::type;
+    };
+
+    template <>
+    struct make_indices<0> { using type = indices<>; };
+
+    template <>
+    struct make_indices<1> { using type = indices<0>; };
+
+    // Compile-time sum of a pack, unrolled
+    template < class T >
+    constexpr T sum(const T& value)
+        { return value; }
+
+    template < class T, class... Rest >
+    constexpr T sum(const T& first, const Rest&... rest)
+        { return first + maths::sum(rest...); }
+
+    // Compile-time conjunction of a pack, unrolled
+    constexpr bool all()
+        { return true; }
+
+    template < class... Rest >
+    constexpr bool all(const bool& first, const Rest&... rest)
+        { return first && maths::all(rest...); }
+
     template < class A, class B, class C, class D >
     auto cross_product(const A& a, const B& b, const C& c, const D& d) -> decltype(a * d - b * c)
         { return a * d - b * c; }
@@ -16,21 +16,21 @@
 #include "Matrix.hpp"
 #include "Vector.hpp"
 
-template < class K >
-Vector<K> linear_combination(const std::vector<Vector<K>>& u, const std::vector<K>& coefs)
+template < class K, class A = maths::AlignedAllocator<K> >
+Vector<K, A> linear_combination(const std::vector<Vector<K, A>>& u, const std::vector<K>& coefs)
 {
     if (u.size() != coefs.size())
         throw std::logic_error("cannot operate on arrays of different lengths");
     if (u.empty())
-        return Vector<K>(0);
+        return Vector<K, A>(0);
 
     size_t scale = u[0].size();
-    Vector<K> tmp(scale);
+    Vector<K, A> tmp(scale);
     for (size_t i = 0; i < u.size(); ++i)
     {
         if (u[i].size() != scale)
             throw std::logic_error("cannot operate on vectors of various sizes");
-        tmp += u[i] * coefs[i];
+        tmp += maths::lazy(u[i]) * coefs[i];
     }
     return tmp;
 }
@@ -39,8 +39,22 @@ template < class V >
 V lerp(const V& u, const V& v, const float& t)
     { return maths::fma(v - u, t, u); }
 
-template < class K >
-K angle_cos(const Vector<K>& u, const Vector<K>& v)
+/**
+ * Interpolates between two vectors, evaluated in a single pass into the result
+ */
+template < class K, class A >
+Vector<K, A> lerp(const Vector<K, A>& u, const Vector<K, A>& v, const float& t)
+    { return (maths::lazy(v) - u) * static_cast<K>(t) + u; }
+
+/**
+ * Interpolates between two matrices, evaluated in a single pass into the result
+ */
+template < class K, class A >
+Matrix<K, A> lerp(const Matrix<K, A>& u, const Matrix<K, A>& v, const float& t)
+    { return (maths::lazy(v) - u) * static_cast<K>(t) + u; }
+
+template < class K, class A = maths::AlignedAllocator<K> >
+K angle_cos(const Vector<K, A>& u, const Vector<K, A>& v)
 {
     if (u.size() != v.size())
         throw std::logic_error("cannot operate on vectors of various sizes");
@@ -49,16 +63,39 @@ K angle_cos(const Vector<K>& u, const Vector<K>& v)
     return u.dot(v) / (u.norm_2() * v.norm_2());
 }
 
-template < class K >
-Vector<K> cross_product(const Vector<K>& u, const Vector<K>& v)
+template < class K, class A = maths::AlignedAllocator<K> >
+Vector<K, A> cross_product(const Vector<K, A>& u, const Vector<K, A>& v)
 {
     if (u.size() != 3 || v.size() != 3)
         throw std::logic_error("cannot operate on vectors with heights different than 3");
-    return Vector<K>({
+    return Vector<K, A>({
         u[1] * v[2] - u[2] * v[1],
         u[2] * v[0] - u[0] * v[2],
         u[0] * v[1] - u[1] * v[0]
     });
 }
 
+/**
+ * Solves the system `AX = B`, factorizing A once for all the columns of B.
+ * For solving many systems against the same matrix, prefer keeping `A.lu()`
+ *
+ * @exception std::logic_error   A is not square, or B not of A's height
+ * @exception std::runtime_error A is singular
+ * @exception std::bad_alloc     Allocation failure
+ */
+template < class K, class A, class B >
+Matrix<K, B> solve(const Matrix<K, A>& a, const Matrix<K, B>& b)
+    { return a.lu().solve(b); }
+
+/**
+ * Solves the system `Ax = b`
+ *
+ * @exception std::logic_error   A is not square, or b not of A's height
+ * @exception std::runtime_error A is singular
+ * @exception std::bad_alloc     Allocation failure
+ */
+template < class K, class A, class B >
+Vector<K, B> solve(const Matrix<K, A>& a, const Vector<K, B>& b)
+    { return a.lu().solve(b); }
+
 #endif //MATHS_HPP
\ No newline at end of file
@@ -0,0 +1,193 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - mixed.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [7:30 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef MIXED_HPP
+#define MIXED_HPP
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "general.hpp"
+#include "gemm.hpp"
+#include "ThreadPool.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * Mixed-precision computations: values are stored (and read from memory) in
+ * a narrow type K, while sums are accumulated in a wider type R, such as
+ * floats accumulated in doubles (see maths::accumulator)
+ */
+namespace maths
+{
+namespace mixed
+{
+    // Maximum amount of refinement steps before solve() falls back to a wide factorization
+    constexpr size_t ITERATIONS = 30;
+
+    /**
+     * Calculates the product of two matrices, accumulated and returned in R.
+     * Operands are converted while packed by the GEMM engine, so they are
+     * only read once in their own type
+     *
+     * @exception std::logic_error  Operands don't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class R, class K >
+    Matrix<R> multiply(const MatrixView<const K>& lhs, const MatrixView<const K>& rhs)
+    {
+        if (lhs.width() != rhs.height())
+            throw std::logic_error("incompatible for multiplication");
+        Matrix<R> result(lhs.height(), rhs.width());
+        maths::gemm::multiply(lhs.height(), rhs.width(), lhs.width(),
+                              lhs.data(), lhs.stride(),
+                              rhs.data(), rhs.stride(),
+                              result.data(), result.stride());
+        return result;
+    }
+
+    template < class R, class K, class A, class B >
+    Matrix<R> multiply(const Matrix<K, A>& lhs, const Matrix<K, B>& rhs)
+        { return multiply<R, K>(lhs.view(), rhs.view()); }
+
+    /**
+     * Calculates `sum + row . x` in R, over a row of values read in K
+     */
+    template < class R, class K, class X >
+    R accumulate(const K * row, const VectorView<const X>& x, R sum)
+    {
+        for (size_t n = 0; n < x.size(); ++n)
+            sum = maths::fma(static_cast<R>(row[n]), static_cast<R>(x[n]), sum);
+        return sum;
+    }
+
+    /**
+     * Calculates the product of a matrix with a vector, accumulated and returned in R
+     *
+     * @exception std::logic_error  Operands don't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class R, class K >
+    Vector<R> multiply(const MatrixView<const K>& lhs, const VectorView<const K>& rhs)
+    {
+        if (lhs.width() != rhs.size())
+            throw std::logic_error("incompatible for multiplication");
+        Vector<R> result(lhs.height());
+        ThreadPool::global().parallel_rows(0, lhs.height(), lhs.width(), [&](const size_t& first, const size_t& last) {
+            for (size_t m = first; m < last; ++m)
+                result[m] = accumulate(lhs.data() + m * lhs.stride(), rhs, R());
+        });
+        return result;
+    }
+
+    template < class R, class K, class A, class B >
+    Vector<R> multiply(const Matrix<K, A>& lhs, const Vector<K, B>& rhs)
+        { return multiply<R, K>(lhs.view(), rhs.view()); }
+
+    /**
+     * Calculates the residual `b - Ax` in R, over a matrix read in K
+     *
+     * @exception std::logic_error  Operands don't match requirements
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class R, class K >
+    Vector<R> residual(const MatrixView<const K>& a, const VectorView<const R>& x, const VectorView<const R>& b)
+    {
+        if (a.width() != x.size() || a.height() != b.size())
+            throw std::logic_error("incompatible for multiplication");
+        Vector<R> result(a.height());
+        ThreadPool::global().parallel_rows(0, a.height(), a.width(), [&](const size_t& first, const size_t& last) {
+            for (size_t m = first; m < last; ++m)
+                result[m] = b[m] - accumulate(a.data() + m * a.stride(), x, R());
+        });
+        return result;
+    }
+
+    /**
+     * Solves the system `Ax = b` by iterative refinement: A is factorized once
+     * in its own type K, then the solution is kept in R and corrected from
+     * residuals calculated in R, until they are negligible in R. This reaches
+     * the accuracy of a factorization in R at the cost of one in K, as long as
+     * A is not too ill-conditioned for K, otherwise A is factorized again in R
+     *
+     * @param a                     Square matrix A
+     * @param b                     Right-hand side, in the accumulation type
+     * @param iterations            Maximum amount of refinement steps
+     * @return                      Solution
+     *
+     * @exception std::logic_error  Matrix is not square, or not of b's height
+     * @exception std::runtime_error Matrix is singular
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class K, class A, class R >
+    Vector<R> solve(const Matrix<K, A>& a, const VectorView<const R>& b, const size_t& iterations = ITERATIONS)
+    {
+        if (!a.square())
+            throw std::logic_error("cannot solve a non-square system");
+        if (b.size() != a.height())
+            throw std::logic_error("cannot solve with different matrix heights");
+
+        const size_t size = a.height();
+        const LU<K, A> lu(a);
+        if (!lu.singular())
+        {
+            // Refinement stops once `|r| <= |x| * |A| * epsilon * sqrt(n)`, in infinity norms
+            R norm = R();
+            for (size_t m = 0; m < size; ++m)
+            {
+                R sum = R();
+                for (size_t n = 0; n < size; ++n)
+                    sum += std::abs(static_cast<R>(a[{ m, n }]));
+                norm = std::max(norm, sum);
+            }
+            const R tolerance = norm * std::numeric_limits<R>::epsilon() * std::sqrt(static_cast<R>(size));
+
+            Vector<K> low(size);
+            Vector<R> x(size);
+            for (size_t m = 0; m < size; ++m)
+                low[m] = static_cast<K>(b[m]);
+            lu.solve_inplace(low.view());
+            for (size_t m = 0; m < size; ++m)
+                x[m] = static_cast<R>(low[m]);
+
+            for (size_t step = 0; step <= iterations; ++step)
+            {
+                const Vector<R> r = residual<R, K>(a.view(), x.view(), b);
+                R largest_r = R(), largest_x = R();
+                for (size_t m = 0; m < size; ++m)
+                {
+                    largest_r = std::max(largest_r, std::abs(r[m]));
+                    largest_x = std::max(largest_x, std::abs(x[m]));
+                }
+                if (largest_r <= largest_x * tolerance)
+                    return x;
+                if (step == iterations)
+                    break;
+
+                for (size_t m = 0; m < size; ++m)
+                    low[m] = static_cast<K>(r[m]);
+                lu.solve_inplace(low.view());
+                for (size_t m = 0; m < size; ++m)
+                    x[m] += static_cast<R>(low[m]);
+            }
+        }
+        return LU<R>(a).solve(Vector<R>(b));
+    }
+
+    template < class K, class A, class R, class B >
+    Vector<R> solve(const Matrix<K, A>& a, const Vector<R, B>& b, const size_t& iterations = ITERATIONS)
+        { return solve(a, b.view(), iterations); }
+}
+}
+
+#endif //MIXED_HPP
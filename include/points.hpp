@@ -0,0 +1,321 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - points.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [6:30 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef POINTS_HPP
+#define POINTS_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "simd.hpp"
+#include "ThreadPool.hpp"
+#include "FixedMatrix.hpp"
+
+namespace maths
+{
+namespace points
+{
+    // Amount of points under which transforms stay on a single thread
+    constexpr size_t PARALLEL_THRESHOLD = 64 * 1024;
+
+    // Amount of points given to each task of a parallel transform
+    constexpr size_t CHUNK = 16 * 1024;
+
+    // Amount of interleaved points gathered at once into coordinate arrays
+    constexpr size_t BLOCK = 256;
+
+    /**
+     * Point buffer in structure-of-arrays layout: one array per coordinate.
+     * Without a `w` array, input points have an implicit `w` of 1, and the
+     * `w` of output points is not calculated
+     *
+     * @tparam T    Coordinate type, `const` for input buffers
+     */
+    template < class T >
+    struct SoA
+    {
+        T * x;
+        T * y;
+        T * z;
+        T * w;
+    };
+
+    /**
+     * Transforms points by a row-major 4 x 4 matrix, one by one
+     *
+     * @param m                     Transform, 16 values row by row
+     * @param in                    Coordinate arrays of the input points
+     * @param out                   Coordinate arrays of the output points
+     * @param first                 First point to transform
+     * @param last                  Past-the-last point to transform
+     */
+    template < class T >
+    void transform_scalar(const T* m, const T* const* in, T* const* out, size_t first, const size_t& last)
+    {
+        for (; first < last; ++first)
+        {
+            const T x = in[0][first], y = in[1][first], z = in[2][first];
+            const T w = in[3] ? in[3][first] : T(1);
+            for (size_t r = 0; r < 4; ++r)
+                if (out[r])
+                    out[r][first] = m[r * 4] * x + m[r * 4 + 1] * y + m[r * 4 + 2] * z + m[r * 4 + 3] * w;
+        }
+    }
+
+    /**
+     * Transform kernel of a vector instruction set, over a pack P: each
+     * coefficient is broadcast once, then points are transformed P::width at a time
+     */
+    template < maths::simd::isa I >
+    struct loops;
+
+#ifdef MATRIX_X86
+# define MATRIX_POINTS_KERNEL(NAME, TARGET) \
+    template <> \
+    struct loops<maths::simd::isa::NAME> \
+    { \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static void transform(const T* m, const T* const* in, T* const* out, size_t count) \
+        { \
+            typename P::type c[16]; \
+            for (size_t e = 0; e < 16; ++e) \
+                c[e] = P::set1(m[e]); \
+            const typename P::type one = P::set1(T(1)); \
+            size_t i = 0; \
+            for (; i + P::width <= count; i += P::width) \
+            { \
+                const typename P::type x = P::load(in[0] + i); \
+                const typename P::type y = P::load(in[1] + i); \
+                const typename P::type z = P::load(in[2] + i); \
+                const typename P::type w = in[3] ? P::load(in[3] + i) : one; \
+                for (size_t r = 0; r < 4; ++r) \
+                    if (out[r]) \
+                        P::store(out[r] + i, P::add(P::add(P::mul(c[r * 4], x), P::mul(c[r * 4 + 1], y)), \
+                                                    P::add(P::mul(c[r * 4 + 2], z), P::mul(c[r * 4 + 3], w)))); \
+            } \
+            transform_scalar(m, in, out, i, count); \
+        } \
+    };
+
+    MATRIX_SIMD_TARGETS(MATRIX_POINTS_KERNEL)
+# undef MATRIX_POINTS_KERNEL
+#endif
+
+    template < class T >
+    using kernel_type = void (*)(const T*, const T* const*, T* const*, size_t);
+
+    template < class T >
+    void transform_plain(const T* m, const T* const* in, T* const* out, size_t count)
+        { transform_scalar(m, in, out, 0, count); }
+
+    /**
+     * Selects the transform kernel of T for an instruction set (see maths::simd::dispatch())
+     */
+    template < class T >
+    struct selector
+    {
+        template < maths::simd::isa I >
+        kernel_type<T> operator()(maths::simd::isa_tag<I>) const noexcept
+            { return &loops<I>::template transform<maths::simd::pack<T, I>, T>; }
+
+        kernel_type<T> operator()(maths::simd::isa_tag<maths::simd::isa::scalar>) const noexcept
+            { return &transform_plain<T>; }
+    };
+
+    /**
+     * Selects the transform kernel of T for the running CPU
+     */
+    template < class T >
+    kernel_type<T> select(std::true_type) noexcept
+        { return maths::simd::dispatch(selector<T>()); }
+
+    template < class T >
+    kernel_type<T> select(std::false_type) noexcept
+        { return &transform_plain<T>; }
+
+    /**
+     * Retrieves the transform kernel of T, selected on first use
+     * (floating-point types only are vectorized)
+     */
+    template < class T >
+    kernel_type<T> kernel() noexcept
+    {
+        static const kernel_type<T> value = select<T>(std::integral_constant<bool,
+            std::is_floating_point<T>::value && maths::simd::lane_of<T>::value != maths::simd::lane::none>());
+        return value;
+    }
+
+    /**
+     * Runs `body(first, last)` over ranges of points, in parallel on the shared
+     * thread pool for large batches
+     */
+    template < class F >
+    void for_chunks(const size_t& count, const F& body)
+    {
+        ThreadPool& pool = ThreadPool::global();
+        if (pool.size() == 1 || count < PARALLEL_THRESHOLD)
+            return body(size_t(0), count);
+        pool.parallel_for((count + CHUNK - 1) / CHUNK, [&](const size_t& chunk) {
+            body(chunk * CHUNK, std::min(count, (chunk + 1) * CHUNK));
+        });
+    }
+
+    /**
+     * Copies a row-major 4 x 4 dense matrix into an array of 16 values
+     *
+     * @exception std::logic_error  Matrix is not 4 x 4
+     */
+    template < class T, class A >
+    FixedMatrix<T, 4, 4> fixed(const Matrix<T, A>& matrix)
+    {
+        if (matrix.height() != 4 || matrix.width() != 4)
+            throw std::logic_error("point transforms must be 4x4 matrices");
+        FixedMatrix<T, 4, 4> result;
+        for (size_t m = 0; m < 4; ++m)
+            for (size_t n = 0; n < 4; ++n)
+                result(m, n) = matrix[{ m, n }];
+        return result;
+    }
+
+    /**
+     * Transforms points in structure-of-arrays layout by the same matrix,
+     * several points at a time in vector registers, and over the shared
+     * thread pool for large batches. Points are multiplied as column vectors
+     * (`p' = M * p`), without perspective division. The output may be the input
+     *
+     * @param m                     Transform
+     * @param in                    Input points
+     * @param out                   Output points
+     * @param count                 Amount of points
+     */
+    template < class T >
+    void transform(const FixedMatrix<T, 4, 4>& m, const SoA<const T>& in, const SoA<T>& out, const size_t& count)
+    {
+        const kernel_type<T> run = kernel<T>();
+        const T * values = m.data();
+        for_chunks(count, [&](const size_t& first, const size_t& last) {
+            const T * const source[4] = { in.x + first, in.y + first, in.z + first, in.w ? in.w + first : nullptr };
+            T * const target[4] = { out.x + first, out.y + first, out.z + first, out.w ? out.w + first : nullptr };
+            run(values, source, target, last - first);
+        });
+    }
+
+    /**
+     * Transforms interleaved points (array-of-structures, `x y z` or `x y z w`)
+     * by the same matrix. Blocks of points are gathered into coordinate arrays
+     * on the stack, transformed as by the structure-of-arrays overload, then
+     * scattered back. With 3 coordinates, `w` is taken as 1 and not written
+     *
+     * @param m                     Transform
+     * @param in                    Input points
+     * @param out                   Output points (may be the input)
+     * @param count                 Amount of points
+     * @param dimensions            Coordinates per point, 3 or 4
+     *
+     * @exception std::logic_error  Points are neither 3D nor 4D
+     */
+    template < class T >
+    void transform(const FixedMatrix<T, 4, 4>& m, const T* in, T* out, const size_t& count,
+                   const size_t& dimensions = 4)
+    {
+        if (dimensions != 3 && dimensions != 4)
+            throw std::logic_error("points must have 3 or 4 coordinates");
+        const kernel_type<T> run = kernel<T>();
+        const T * values = m.data();
+        for_chunks(count, [&](const size_t& first, const size_t& last) {
+            T block[4][BLOCK];
+            const T * const source[4] = { block[0], block[1], block[2], dimensions == 4 ? block[3] : nullptr };
+            T * const target[4] = { block[0], block[1], block[2], dimensions == 4 ? block[3] : nullptr };
+            for (size_t start = first; start < last; start += BLOCK)
+            {
+                const size_t size = std::min(BLOCK, last - start);
+                const T * from = in + start * dimensions;
+                for (size_t i = 0; i < size; ++i)
+                    for (size_t d = 0; d < dimensions; ++d)
+                        block[d][i] = from[i * dimensions + d];
+                run(values, source, target, size);
+                T * to = out + start * dimensions;
+                for (size_t i = 0; i < size; ++i)
+                    for (size_t d = 0; d < dimensions; ++d)
+                        to[i * dimensions + d] = block[d][i];
+            }
+        });
+    }
+
+    /**
+     * Transforms points in structure-of-arrays layout, each by its own matrix
+     *
+     * @param transforms            One transform per point
+     * @param in                    Input points
+     * @param out                   Output points (may be the input)
+     * @param count                 Amount of points
+     */
+    template < class T >
+    void transform(const FixedMatrix<T, 4, 4>* transforms, const SoA<const T>& in, const SoA<T>& out,
+                   const size_t& count)
+    {
+        for_chunks(count, [&](const size_t& first, const size_t& last) {
+            for (size_t i = first; i < last; ++i)
+            {
+                const T * const source[4] = { in.x + i, in.y + i, in.z + i, in.w ? in.w + i : nullptr };
+                T * const target[4] = { out.x + i, out.y + i, out.z + i, out.w ? out.w + i : nullptr };
+                transform_scalar(transforms[i].data(), source, target, 0, 1);
+            }
+        });
+    }
+
+    /**
+     * Transforms interleaved points (`x y z` or `x y z w`), each by its own matrix.
+     * With 3 coordinates, `w` is taken as 1 and not written
+     *
+     * @param transforms            One transform per point
+     * @param in                    Input points
+     * @param out                   Output points (may be the input)
+     * @param count                 Amount of points
+     * @param dimensions            Coordinates per point, 3 or 4
+     *
+     * @exception std::logic_error  Points are neither 3D nor 4D
+     */
+    template < class T >
+    void transform(const FixedMatrix<T, 4, 4>* transforms, const T* in, T* out, const size_t& count,
+                   const size_t& dimensions = 4)
+    {
+        if (dimensions != 3 && dimensions != 4)
+            throw std::logic_error("points must have 3 or 4 coordinates");
+        for_chunks(count, [&](const size_t& first, const size_t& last) {
+            for (size_t i = first; i < last; ++i)
+            {
+                const T * m = transforms[i].data();
+                const T * p = in + i * dimensions;
+                const T x = p[0], y = p[1], z = p[2], w = dimensions == 4 ? p[3] : T(1);
+                T * q = out + i * dimensions;
+                for (size_t r = 0; r < dimensions; ++r)
+                    q[r] = m[r * 4] * x + m[r * 4 + 1] * y + m[r * 4 + 2] * z + m[r * 4 + 3] * w;
+            }
+        });
+    }
+
+    /**
+     * Transforms points by a dense 4 x 4 matrix (see the FixedMatrix overloads)
+     *
+     * @exception std::logic_error  Matrix is not 4 x 4, or points are neither 3D nor 4D
+     */
+    template < class T, class A >
+    void transform(const Matrix<T, A>& m, const SoA<const T>& in, const SoA<T>& out, const size_t& count)
+        { transform(fixed(m), in, out, count); }
+
+    template < class T, class A >
+    void transform(const Matrix<T, A>& m, const T* in, T* out, const size_t& count, const size_t& dimensions = 4)
+        { transform(fixed(m), in, out, count, dimensions); }
+}
+}
+
+#endif //POINTS_HPP
@@ -0,0 +1,621 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - simd.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [11:03 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+# define MATRIX_X86 1
+# include <immintrin.h>
+#endif
+
+namespace maths
+{
+namespace simd
+{
+    /**
+     * Instruction sets the kernels can be dispatched to,
+     * ordered from the least to the most capable
+     */
+    enum class isa : int
+    {
+        scalar = 0, // Plain C++ loops
+        sse2,       // 128-bit vectors
+        avx2,       // 256-bit vectors
+        avx512      // 512-bit vectors (requires AVX-512 F and DQ)
+    };
+
+    /**
+     * Queries the CPU (through CPUID) for the best supported instruction set
+     *
+     * @return                      Best instruction set available
+     */
+    inline isa detect() noexcept
+    {
+#ifdef MATRIX_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+            return isa::avx512;
+        if (__builtin_cpu_supports("avx2"))
+            return isa::avx2;
+        if (__builtin_cpu_supports("sse2"))
+            return isa::sse2;
+#endif
+        return isa::scalar;
+    }
+
+    /**
+     * Retrieves the instruction set used by the kernels, detected once
+     *
+     * @return                      Instruction set in use
+     */
+    inline isa level() noexcept
+    {
+        static const isa value = detect();
+        return value;
+    }
+
+    // Instruction set as a type, to overload on
+    template < isa I >
+    using isa_tag = std::integral_constant<isa, I>;
+
+    /**
+     * Calls `select` with the tag of the instruction set in use, always the
+     * scalar one on other processors: overloads for the vector instruction
+     * sets are then never instantiated
+     *
+     * @param select                Function object taking an isa_tag
+     * @return                      Result of `select`
+     */
+    template < class S >
+    auto dispatch(const S& select) -> decltype(select(isa_tag<isa::scalar>()))
+    {
+#ifdef MATRIX_X86
+        switch (level())
+        {
+        case isa::avx512:
+            return select(isa_tag<isa::avx512>());
+        case isa::avx2:
+            return select(isa_tag<isa::avx2>());
+        case isa::sse2:
+            return select(isa_tag<isa::sse2>());
+        case isa::scalar:
+            break;
+        }
+#endif
+        return select(isa_tag<isa::scalar>());
+    }
+
+    /**
+     * Function object constructing a T from the given isa_tag (see dispatch())
+     */
+    template < class T >
+    struct construct
+    {
+        template < class Tag >
+        T operator()(const Tag& tag) const noexcept
+            { return T(tag); }
+    };
+
+    /**
+     * Checks once whether the running CPU supports fused multiply-add instructions
+     *
+     * @return                      TRUE if supported, otherwise FALSE
+     */
+    inline bool has_fma() noexcept
+    {
+#ifdef MATRIX_X86
+        static const bool value = []() {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("fma") != 0;
+        }();
+        return value;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Element categories which have dedicated vector kernels
+     */
+    enum class lane { none, f32, f64, i32, i64 };
+
+    template < class T >
+    struct lane_of : std::integral_constant<lane,
+        std::is_same<T, float>::value  ? lane::f32 :
+        std::is_same<T, double>::value ? lane::f64 :
+        std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 4 ? lane::i32 :
+        std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 8 ? lane::i64 :
+        lane::none> {};
+
+    /////// SCALAR KERNELS ///////
+
+    template < class T >
+    void add_scalar(T* dst, const T* src, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            dst[i] += src[i];
+    }
+
+    template < class T >
+    void sub_scalar(T* dst, const T* src, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            dst[i] -= src[i];
+    }
+
+    template < class T >
+    void scale_scalar(T* dst, T value, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            dst[i] *= value;
+    }
+
+    template < class T >
+    void abs_scalar(T* dst, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            if (dst[i] < T())
+                dst[i] = -dst[i];
+    }
+
+    template < class T >
+    bool equal_scalar(const T* a, const T* b, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            if (a[i] != b[i])
+                return false;
+        return true;
+    }
+
+    /**
+     * Vector pack wrapping the intrinsics of an instruction set for a given type.
+     * Left undefined when there is no such pack. Floating-point packs also
+     * provide `max`, which integer ones lack before SSE4.1
+     */
+    template < class T, isa I, lane L = lane_of<T>::value >
+    struct pack;
+
+    /**
+     * Element-wise loops of a vector instruction set, over a pack P
+     */
+    template < isa I >
+    struct loops;
+
+#ifdef MATRIX_X86
+    // Calls `DEFINE(NAME, TARGET)` for every vector instruction set, with its
+    // name in isa and its target attribute. Kernels are written once in such a
+    // macro, as the target attribute cannot depend on a template parameter, and
+    // each expansion specializes a template over isa for dispatch() to select
+# define MATRIX_SIMD_TARGETS(DEFINE) \
+    DEFINE(sse2, "sse2") \
+    DEFINE(avx2, "avx2") \
+    DEFINE(avx512, "avx512f,avx512dq")
+
+# define MATRIX_SIMD_LOOPS(NAME, TARGET) \
+    template <> \
+    struct loops<isa::NAME> \
+    { \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static void add(T* dst, const T* src, size_t n) \
+        { \
+            size_t i = 0; \
+            for (; i + P::width <= n; i += P::width) \
+                P::store(dst + i, P::add(P::load(dst + i), P::load(src + i))); \
+            add_scalar(dst + i, src + i, n - i); \
+        } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static void sub(T* dst, const T* src, size_t n) \
+        { \
+            size_t i = 0; \
+            for (; i + P::width <= n; i += P::width) \
+                P::store(dst + i, P::sub(P::load(dst + i), P::load(src + i))); \
+            sub_scalar(dst + i, src + i, n - i); \
+        } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static void scale(T* dst, T value, size_t n) \
+        { \
+            const typename P::type factor = P::set1(value); \
+            size_t i = 0; \
+            for (; i + P::width <= n; i += P::width) \
+                P::store(dst + i, P::mul(P::load(dst + i), factor)); \
+            scale_scalar(dst + i, value, n - i); \
+        } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static void abs(T* dst, size_t n) \
+        { \
+            size_t i = 0; \
+            for (; i + P::width <= n; i += P::width) \
+                P::store(dst + i, P::abs(P::load(dst + i))); \
+            abs_scalar(dst + i, n - i); \
+        } \
+        template < class P, class T > __attribute__((target(TARGET))) \
+        static bool equal(const T* a, const T* b, size_t n) \
+        { \
+            size_t i = 0; \
+            for (; i + P::width <= n; i += P::width) \
+                if (!P::equal(P::load(a + i), P::load(b + i))) \
+                    return false; \
+            return equal_scalar(a + i, b + i, n - i); \
+        } \
+    };
+
+    MATRIX_SIMD_TARGETS(MATRIX_SIMD_LOOPS)
+# undef MATRIX_SIMD_LOOPS
+
+# define MATRIX_SIMD_SSE2 __attribute__((target("sse2"))) static
+# define MATRIX_SIMD_AVX2 __attribute__((target("avx2"))) static
+# define MATRIX_SIMD_AVX512 __attribute__((target("avx512f,avx512dq"))) static
+
+    /////// SSE2 PACKS ///////
+
+    template < class T >
+    struct pack<T, isa::sse2, lane::f32>
+    {
+        using type = __m128;
+        static constexpr size_t width = 4;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_SSE2 type load(const T* p) { return _mm_loadu_ps(p); }
+        MATRIX_SIMD_SSE2 void store(T* p, type v) { _mm_storeu_ps(p, v); }
+        MATRIX_SIMD_SSE2 type set1(T v) { return _mm_set1_ps(v); }
+        MATRIX_SIMD_SSE2 type add(type a, type b) { return _mm_add_ps(a, b); }
+        MATRIX_SIMD_SSE2 type sub(type a, type b) { return _mm_sub_ps(a, b); }
+        MATRIX_SIMD_SSE2 type mul(type a, type b) { return _mm_mul_ps(a, b); }
+        MATRIX_SIMD_SSE2 type abs(type a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+        MATRIX_SIMD_SSE2 type max(type a, type b) { return _mm_max_ps(a, b); }
+        MATRIX_SIMD_SSE2 bool equal(type a, type b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)) == 0xF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::sse2, lane::f64>
+    {
+        using type = __m128d;
+        static constexpr size_t width = 2;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_SSE2 type load(const T* p) { return _mm_loadu_pd(p); }
+        MATRIX_SIMD_SSE2 void store(T* p, type v) { _mm_storeu_pd(p, v); }
+        MATRIX_SIMD_SSE2 type set1(T v) { return _mm_set1_pd(v); }
+        MATRIX_SIMD_SSE2 type add(type a, type b) { return _mm_add_pd(a, b); }
+        MATRIX_SIMD_SSE2 type sub(type a, type b) { return _mm_sub_pd(a, b); }
+        MATRIX_SIMD_SSE2 type mul(type a, type b) { return _mm_mul_pd(a, b); }
+        MATRIX_SIMD_SSE2 type abs(type a) { return _mm_andnot_pd(_mm_set1_pd(-0.), a); }
+        MATRIX_SIMD_SSE2 type max(type a, type b) { return _mm_max_pd(a, b); }
+        MATRIX_SIMD_SSE2 bool equal(type a, type b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)) == 0x3; }
+    };
+
+    template < class T >
+    struct pack<T, isa::sse2, lane::i32>
+    {
+        using type = __m128i;
+        static constexpr size_t width = 4;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_SSE2 type load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const type*>(p)); }
+        MATRIX_SIMD_SSE2 void store(T* p, type v) { _mm_storeu_si128(reinterpret_cast<type*>(p), v); }
+        MATRIX_SIMD_SSE2 type set1(T v) { return _mm_set1_epi32(static_cast<int>(v)); }
+        MATRIX_SIMD_SSE2 type add(type a, type b) { return _mm_add_epi32(a, b); }
+        MATRIX_SIMD_SSE2 type sub(type a, type b) { return _mm_sub_epi32(a, b); }
+        MATRIX_SIMD_SSE2 type mul(type a, type b)
+        {
+            // No 32-bit low multiply before SSE4.1: multiply even and odd lanes separately
+            const type even = _mm_mul_epu32(a, b);
+            const type odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        }
+        MATRIX_SIMD_SSE2 type abs(type a)
+        {
+            const type sign = _mm_srai_epi32(a, 31);
+            return _mm_sub_epi32(_mm_xor_si128(a, sign), sign);
+        }
+        MATRIX_SIMD_SSE2 bool equal(type a, type b) { return _mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) == 0xFFFF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::sse2, lane::i64>
+    {
+        using type = __m128i;
+        static constexpr size_t width = 2;
+        static constexpr bool vector_mul = false;
+        MATRIX_SIMD_SSE2 type load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const type*>(p)); }
+        MATRIX_SIMD_SSE2 void store(T* p, type v) { _mm_storeu_si128(reinterpret_cast<type*>(p), v); }
+        MATRIX_SIMD_SSE2 type set1(T v) { return _mm_set1_epi64x(static_cast<long long>(v)); }
+        MATRIX_SIMD_SSE2 type add(type a, type b) { return _mm_add_epi64(a, b); }
+        MATRIX_SIMD_SSE2 type sub(type a, type b) { return _mm_sub_epi64(a, b); }
+        MATRIX_SIMD_SSE2 type mul(type a, type) { return a; }
+        MATRIX_SIMD_SSE2 type abs(type a)
+        {
+            const type sign = _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+            return _mm_sub_epi64(_mm_xor_si128(a, sign), sign);
+        }
+        MATRIX_SIMD_SSE2 bool equal(type a, type b) { return _mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) == 0xFFFF; }
+    };
+
+    /////// AVX2 PACKS ///////
+
+    template < class T >
+    struct pack<T, isa::avx2, lane::f32>
+    {
+        using type = __m256;
+        static constexpr size_t width = 8;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX2 type load(const T* p) { return _mm256_loadu_ps(p); }
+        MATRIX_SIMD_AVX2 void store(T* p, type v) { _mm256_storeu_ps(p, v); }
+        MATRIX_SIMD_AVX2 type set1(T v) { return _mm256_set1_ps(v); }
+        MATRIX_SIMD_AVX2 type add(type a, type b) { return _mm256_add_ps(a, b); }
+        MATRIX_SIMD_AVX2 type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+        MATRIX_SIMD_AVX2 type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+        MATRIX_SIMD_AVX2 type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+        MATRIX_SIMD_AVX2 type max(type a, type b) { return _mm256_max_ps(a, b); }
+        MATRIX_SIMD_AVX2 bool equal(type a, type b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)) == 0xFF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::avx2, lane::f64>
+    {
+        using type = __m256d;
+        static constexpr size_t width = 4;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX2 type load(const T* p) { return _mm256_loadu_pd(p); }
+        MATRIX_SIMD_AVX2 void store(T* p, type v) { _mm256_storeu_pd(p, v); }
+        MATRIX_SIMD_AVX2 type set1(T v) { return _mm256_set1_pd(v); }
+        MATRIX_SIMD_AVX2 type add(type a, type b) { return _mm256_add_pd(a, b); }
+        MATRIX_SIMD_AVX2 type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+        MATRIX_SIMD_AVX2 type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+        MATRIX_SIMD_AVX2 type abs(type a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.), a); }
+        MATRIX_SIMD_AVX2 type max(type a, type b) { return _mm256_max_pd(a, b); }
+        MATRIX_SIMD_AVX2 bool equal(type a, type b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)) == 0xF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::avx2, lane::i32>
+    {
+        using type = __m256i;
+        static constexpr size_t width = 8;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX2 type load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const type*>(p)); }
+        MATRIX_SIMD_AVX2 void store(T* p, type v) { _mm256_storeu_si256(reinterpret_cast<type*>(p), v); }
+        MATRIX_SIMD_AVX2 type set1(T v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+        MATRIX_SIMD_AVX2 type add(type a, type b) { return _mm256_add_epi32(a, b); }
+        MATRIX_SIMD_AVX2 type sub(type a, type b) { return _mm256_sub_epi32(a, b); }
+        MATRIX_SIMD_AVX2 type mul(type a, type b) { return _mm256_mullo_epi32(a, b); }
+        MATRIX_SIMD_AVX2 type abs(type a) { return _mm256_abs_epi32(a); }
+        MATRIX_SIMD_AVX2 bool equal(type a, type b) { return _mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)) == -1; }
+    };
+
+    template < class T >
+    struct pack<T, isa::avx2, lane::i64>
+    {
+        using type = __m256i;
+        static constexpr size_t width = 4;
+        static constexpr bool vector_mul = false;
+        MATRIX_SIMD_AVX2 type load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const type*>(p)); }
+        MATRIX_SIMD_AVX2 void store(T* p, type v) { _mm256_storeu_si256(reinterpret_cast<type*>(p), v); }
+        MATRIX_SIMD_AVX2 type set1(T v) { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+        MATRIX_SIMD_AVX2 type add(type a, type b) { return _mm256_add_epi64(a, b); }
+        MATRIX_SIMD_AVX2 type sub(type a, type b) { return _mm256_sub_epi64(a, b); }
+        MATRIX_SIMD_AVX2 type mul(type a, type) { return a; }
+        MATRIX_SIMD_AVX2 type abs(type a)
+        {
+            const type sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+            return _mm256_sub_epi64(_mm256_xor_si256(a, sign), sign);
+        }
+        MATRIX_SIMD_AVX2 bool equal(type a, type b) { return _mm256_movemask_epi8(_mm256_cmpeq_epi64(a, b)) == -1; }
+    };
+
+    /////// AVX-512 PACKS ///////
+
+    template < class T >
+    struct pack<T, isa::avx512, lane::f32>
+    {
+        using type = __m512;
+        static constexpr size_t width = 16;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX512 type load(const T* p) { return _mm512_loadu_ps(p); }
+        MATRIX_SIMD_AVX512 void store(T* p, type v) { _mm512_storeu_ps(p, v); }
+        MATRIX_SIMD_AVX512 type set1(T v) { return _mm512_set1_ps(v); }
+        MATRIX_SIMD_AVX512 type add(type a, type b) { return _mm512_add_ps(a, b); }
+        MATRIX_SIMD_AVX512 type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+        MATRIX_SIMD_AVX512 type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+        MATRIX_SIMD_AVX512 type abs(type a) { return _mm512_abs_ps(a); }
+        MATRIX_SIMD_AVX512 type max(type a, type b) { return _mm512_max_ps(a, b); }
+        MATRIX_SIMD_AVX512 bool equal(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ) == 0xFFFF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::avx512, lane::f64>
+    {
+        using type = __m512d;
+        static constexpr size_t width = 8;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX512 type load(const T* p) { return _mm512_loadu_pd(p); }
+        MATRIX_SIMD_AVX512 void store(T* p, type v) { _mm512_storeu_pd(p, v); }
+        MATRIX_SIMD_AVX512 type set1(T v) { return _mm512_set1_pd(v); }
+        MATRIX_SIMD_AVX512 type add(type a, type b) { return _mm512_add_pd(a, b); }
+        MATRIX_SIMD_AVX512 type sub(type a, type b) { return _mm512_sub_pd(a, b); }
+        MATRIX_SIMD_AVX512 type mul(type a, type b) { return _mm512_mul_pd(a, b); }
+        MATRIX_SIMD_AVX512 type abs(type a) { return _mm512_abs_pd(a); }
+        MATRIX_SIMD_AVX512 type max(type a, type b) { return _mm512_max_pd(a, b); }
+        MATRIX_SIMD_AVX512 bool equal(type a, type b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ) == 0xFF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::avx512, lane::i32>
+    {
+        using type = __m512i;
+        static constexpr size_t width = 16;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX512 type load(const T* p) { return _mm512_loadu_si512(p); }
+        MATRIX_SIMD_AVX512 void store(T* p, type v) { _mm512_storeu_si512(p, v); }
+        MATRIX_SIMD_AVX512 type set1(T v) { return _mm512_set1_epi32(static_cast<int>(v)); }
+        MATRIX_SIMD_AVX512 type add(type a, type b) { return _mm512_add_epi32(a, b); }
+        MATRIX_SIMD_AVX512 type sub(type a, type b) { return _mm512_sub_epi32(a, b); }
+        MATRIX_SIMD_AVX512 type mul(type a, type b) { return _mm512_mullo_epi32(a, b); }
+        MATRIX_SIMD_AVX512 type abs(type a) { return _mm512_maskz_abs_epi32(0xFFFF, a); }
+        MATRIX_SIMD_AVX512 bool equal(type a, type b) { return _mm512_cmpeq_epi32_mask(a, b) == 0xFFFF; }
+    };
+
+    template < class T >
+    struct pack<T, isa::avx512, lane::i64>
+    {
+        using type = __m512i;
+        static constexpr size_t width = 8;
+        static constexpr bool vector_mul = true;
+        MATRIX_SIMD_AVX512 type load(const T* p) { return _mm512_loadu_si512(p); }
+        MATRIX_SIMD_AVX512 void store(T* p, type v) { _mm512_storeu_si512(p, v); }
+        MATRIX_SIMD_AVX512 type set1(T v) { return _mm512_set1_epi64(static_cast<long long>(v)); }
+        MATRIX_SIMD_AVX512 type add(type a, type b) { return _mm512_add_epi64(a, b); }
+        MATRIX_SIMD_AVX512 type sub(type a, type b) { return _mm512_sub_epi64(a, b); }
+        MATRIX_SIMD_AVX512 type mul(type a, type b) { return _mm512_mullo_epi64(a, b); }
+        MATRIX_SIMD_AVX512 type abs(type a) { return _mm512_maskz_abs_epi64(0xFF, a); }
+        MATRIX_SIMD_AVX512 bool equal(type a, type b) { return _mm512_cmpeq_epi64_mask(a, b) == 0xFF; }
+    };
+
+# undef MATRIX_SIMD_SSE2
+# undef MATRIX_SIMD_AVX2
+# undef MATRIX_SIMD_AVX512
+#endif
+
+    /**
+     * Table of element-wise kernels for a type with vector lanes (see table()
+     * for the one of the running CPU)
+     *
+     * @tparam T    Element type
+     */
+    template < class T >
+    struct kernels
+    {
+        void (*add)(T*, const T*, size_t)           = add_scalar<T>;
+        void (*sub)(T*, const T*, size_t)           = sub_scalar<T>;
+        void (*scale)(T*, T, size_t)                = scale_scalar<T>;
+        void (*abs)(T*, size_t)                     = abs_scalar<T>;
+        bool (*equal)(const T*, const T*, size_t)   = equal_scalar<T>;
+
+        /**
+         * Constructs the table of the plain loops
+         */
+        kernels() noexcept = default;
+
+        explicit kernels(isa_tag<isa::scalar>) noexcept {}
+
+        /**
+         * Constructs the table of a vector instruction set, keeping the plain
+         * multiply where its packs have none (64-bit integers before AVX-512)
+         */
+        template < isa I >
+        explicit kernels(isa_tag<I>) noexcept:
+            add(&loops<I>::template add<pack<T, I>, T>),
+            sub(&loops<I>::template sub<pack<T, I>, T>),
+            abs(&loops<I>::template abs<pack<T, I>, T>),
+            equal(&loops<I>::template equal<pack<T, I>, T>)
+        {
+            if (pack<T, I>::vector_mul)
+                this->scale = &loops<I>::template scale<pack<T, I>, T>;
+        }
+    };
+
+    /**
+     * Retrieves the kernels table of the given type, selected on first use
+     *
+     * @return                      Kernels table
+     */
+    template < class T >
+    const kernels<T>& table() noexcept
+    {
+        static const kernels<T> value = dispatch(construct<kernels<T>>());
+        return value;
+    }
+
+    // Whether T goes through the dispatched kernels or the plain loops
+    template < class T >
+    using vectorized = std::integral_constant<bool, lane_of<T>::value != lane::none>;
+
+    template < class T >
+    void add(T* dst, const T* src, const size_t& n, std::true_type)
+        { table<T>().add(dst, src, n); }
+
+    template < class T >
+    void add(T* dst, const T* src, const size_t& n, std::false_type)
+        { add_scalar(dst, src, n); }
+
+    template < class T >
+    void sub(T* dst, const T* src, const size_t& n, std::true_type)
+        { table<T>().sub(dst, src, n); }
+
+    template < class T >
+    void sub(T* dst, const T* src, const size_t& n, std::false_type)
+        { sub_scalar(dst, src, n); }
+
+    template < class T >
+    void scale(T* dst, const T& value, const size_t& n, std::true_type)
+        { table<T>().scale(dst, value, n); }
+
+    template < class T >
+    void scale(T* dst, const T& value, const size_t& n, std::false_type)
+        { scale_scalar(dst, value, n); }
+
+    template < class T >
+    void abs(T* dst, const size_t& n, std::true_type)
+        { table<T>().abs(dst, n); }
+
+    template < class T >
+    void abs(T* dst, const size_t& n, std::false_type)
+        { abs_scalar(dst, n); }
+
+    template < class T >
+    bool equal(const T* a, const T* b, const size_t& n, std::true_type)
+        { return table<T>().equal(a, b, n); }
+
+    template < class T >
+    bool equal(const T* a, const T* b, const size_t& n, std::false_type)
+        { return equal_scalar(a, b, n); }
+
+    /**
+     * Adds `src` to `dst`, element-wise
+     */
+    template < class T >
+    void add(T* dst, const T* src, const size_t& n)
+        { add(dst, src, n, vectorized<T>()); }
+
+    /**
+     * Subtracts `src` from `dst`, element-wise
+     */
+    template < class T >
+    void sub(T* dst, const T* src, const size_t& n)
+        { sub(dst, src, n, vectorized<T>()); }
+
+    /**
+     * Multiplies every element of `dst` by a scalar
+     */
+    template < class T >
+    void scale(T* dst, const T& value, const size_t& n)
+        { scale(dst, value, n, vectorized<T>()); }
+
+    /**
+     * Replaces every element of `dst` by its absolute value
+     */
+    template < class T >
+    void abs(T* dst, const size_t& n)
+        { abs(dst, n, vectorized<T>()); }
+
+    /**
+     * Checks if the two arrays hold the same values
+     */
+    template < class T >
+    bool equal(const T* a, const T* b, const size_t& n)
+        { return equal(a, b, n, vectorized<T>()); }
+}
+}
+
+#endif //SIMD_HPP
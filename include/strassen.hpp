@@ -0,0 +1,232 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - strassen.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [2:20 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef STRASSEN_HPP
+#define STRASSEN_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <atomic>
+#include <algorithm>
+#include "general.hpp"
+#include "ThreadPool.hpp"
+#include "Arena.hpp"
+#include "gemm.hpp"
+
+/**
+ * Strassen-Winograd multiplication: each level splits the operands into
+ * quadrants and trades one of the eight quadrant products for fifteen
+ * additions, down to the crossover size where the classical GEMM engine
+ * takes over, in O(n^2.81) overall. Off by default (see set_crossover())
+ *
+ * Errors are bounded normwise rather than elementwise. With u the unit
+ * roundoff, n = 2^l * n0 and n0 the size of the classical products,
+ * `max |C - C'| <= [(n / n0)^log2(18) * (n0^2 + 6 * n0) - 6 * n] * u * max |A| * max |B|`
+ * (Higham, Accuracy and Stability of Numerical Algorithms, §23.2.2),
+ * against `n * u * |A| * |B|` elementwise for the classical product: every
+ * element is accurate relative to the largest ones, so products of badly
+ * scaled operands lose precision on their smaller elements. Exact types
+ * (such as Modular) are unaffected
+ */
+namespace maths
+{
+namespace strassen
+{
+    /**
+     * Retrieves the crossover setting, initially read from the
+     * `MATRIX_STRASSEN_CROSSOVER` environment variable (0 when unset)
+     */
+    inline std::atomic<size_t>& crossover_setting()
+    {
+        static std::atomic<size_t> crossover([]() {
+            const char* env = std::getenv("MATRIX_STRASSEN_CROSSOVER");
+            const long value = env ? std::strtol(env, nullptr, 10) : 0;
+            return value > 0 ? static_cast<size_t>(value) : size_t(0);
+        }());
+        return crossover;
+    }
+
+    /**
+     * Retrieves the size under which products are classical
+     *
+     * @return                      Crossover size, 0 when Strassen-Winograd is disabled
+     */
+    inline size_t crossover() noexcept
+        { return crossover_setting().load(std::memory_order_relaxed); }
+
+    /**
+     * Enables Strassen-Winograd for the products of matrices (see
+     * Matrix.operator*()) which three dimensions are all at least the given
+     * size, recursing until the quadrants get below it. The best crossover
+     * depends on the machine, usually between 512 and 2048
+     *
+     * @param size                  Crossover size, 0 to disable Strassen-Winograd
+     */
+    inline void set_crossover(const size_t& size) noexcept
+        { crossover_setting().store(size, std::memory_order_relaxed); }
+
+    /**
+     * Retrieves the amount of levels of recursion of a m x k by k x n
+     * product: as long as the smallest dimension is not below the crossover
+     */
+    inline size_t levels(const size_t& m, const size_t& n, const size_t& k) noexcept
+    {
+        const size_t limit = crossover();
+        size_t result = 0;
+        if (!limit)
+            return result;
+        for (size_t size = std::min(m, std::min(n, k)); size >= limit && size > 1; size = (size + 1) / 2)
+            ++result;
+        return result;
+    }
+
+    /**
+     * Whether products of T are to run Strassen-Winograd: fields only, as
+     * the subtractions of integers could overflow where the classical product
+     * would not
+     */
+    template < class T >
+    bool applies(const size_t& m, const size_t& n, const size_t& k) noexcept
+        { return maths::is_field<T>::value && levels(m, n, k); }
+
+    /**
+     * Calculates `out = x + y`, or `out = x - y` with `subtract`, out
+     * possibly being x or y, over the shared thread pool for large blocks
+     */
+    template < class T >
+    void combine(const size_t& rows, const size_t& cols,
+                 const T* x, const size_t& ldx, const T* y, const size_t& ldy,
+                 T* out, const size_t& ldo, const bool& subtract)
+    {
+        ThreadPool::global().parallel_rows(0, rows, cols, [&](const size_t& first, const size_t& last) {
+            for (size_t i = first; i < last; ++i)
+            {
+                const T* left = x + i * ldx;
+                const T* right = y + i * ldy;
+                T* target = out + i * ldo;
+                if (subtract)
+                    for (size_t j = 0; j < cols; ++j)
+                        target[j] = left[j] - right[j];
+                else
+                    for (size_t j = 0; j < cols; ++j)
+                        target[j] = left[j] + right[j];
+            }
+        });
+    }
+
+    /**
+     * Calculates C = A * B on row-major operands which dimensions are
+     * multiples of `2^levels`, with the schedule of Boyer, Dumas, Pernet and
+     * Zhou: the quadrants of C hold the intermediate products, so that each
+     * level only takes two temporaries from the arena, X (`m/2 x max(k/2, n/2)`)
+     * and Y (`k/2 x n/2`)
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class T >
+    void recurse(const size_t& levels, const size_t& m, const size_t& n, const size_t& k,
+                 const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c, const size_t& ldc)
+    {
+        if (!levels)
+        {
+            for (size_t i = 0; i < m; ++i)
+                std::fill(c + i * ldc, c + i * ldc + n, T());
+            return maths::gemm::multiply(m, n, k, a, lda, b, ldb, c, ldc);
+        }
+
+        const size_t hm = m / 2, hn = n / 2, hk = k / 2;
+        const T *a11 = a, *a12 = a + hk, *a21 = a + hm * lda, *a22 = a21 + hk;
+        const T *b11 = b, *b12 = b + hn, *b21 = b + hk * ldb, *b22 = b21 + hn;
+        T *c11 = c, *c12 = c + hn, *c21 = c + hm * ldc, *c22 = c21 + hn;
+
+        const size_t ldx = std::max(hk, hn), ldy = hn;
+        maths::Scratch<T> xs(hm * ldx), ys(hk * ldy);
+        T* x = xs.get();
+        T* y = ys.get();
+        const size_t next = levels - 1;
+
+        combine(hm, hk, a11, lda, a21, lda, x, ldx, true);      // S3 = A11 - A21
+        combine(hk, hn, b22, ldb, b12, ldb, y, ldy, true);      // T3 = B22 - B12
+        recurse(next, hm, hn, hk, x, ldx, y, ldy, c21, ldc);    // P7 = S3 * T3
+        combine(hm, hk, a21, lda, a22, lda, x, ldx, false);     // S1 = A21 + A22
+        combine(hk, hn, b12, ldb, b11, ldb, y, ldy, true);      // T1 = B12 - B11
+        recurse(next, hm, hn, hk, x, ldx, y, ldy, c22, ldc);    // P5 = S1 * T1
+        combine(hm, hk, x, ldx, a11, lda, x, ldx, true);        // S2 = S1 - A11
+        combine(hk, hn, b22, ldb, y, ldy, y, ldy, true);        // T2 = B22 - T1
+        recurse(next, hm, hn, hk, x, ldx, y, ldy, c12, ldc);    // P6 = S2 * T2
+        combine(hm, hk, a12, lda, x, ldx, x, ldx, true);        // S4 = A12 - S2
+        recurse(next, hm, hn, hk, x, ldx, b22, ldb, c11, ldc);  // P3 = S4 * B22
+        recurse(next, hm, hn, hk, a11, lda, b11, ldb, x, ldx);  // P1 = A11 * B11
+        combine(hm, hn, x, ldx, c12, ldc, c12, ldc, false);     // U2 = P1 + P6
+        combine(hm, hn, c12, ldc, c21, ldc, c21, ldc, false);   // U3 = U2 + P7
+        combine(hm, hn, c12, ldc, c22, ldc, c12, ldc, false);   // U4 = U2 + P5
+        combine(hm, hn, c21, ldc, c22, ldc, c22, ldc, false);   // U7 = U3 + P5, into C22
+        combine(hm, hn, c12, ldc, c11, ldc, c12, ldc, false);   // U5 = U4 + P3, into C12
+        combine(hk, hn, y, ldy, b21, ldb, y, ldy, true);        // T4 = T2 - B21
+        recurse(next, hm, hn, hk, a22, lda, y, ldy, c11, ldc);  // P4 = A22 * T4
+        combine(hm, hn, c21, ldc, c11, ldc, c21, ldc, true);    // U6 = U3 - P4, into C21
+        recurse(next, hm, hn, hk, a12, lda, b21, ldb, c11, ldc);// P2 = A12 * B21
+        combine(hm, hn, x, ldx, c11, ldc, c11, ldc, false);     // U1 = P1 + P2, into C11
+    }
+
+    /**
+     * Calculates C = A * B on row-major operands with Strassen-Winograd,
+     * as many levels deep as the crossover allows (see levels()). Operands
+     * which dimensions are not multiples of `2^levels` are first copied
+     * into zero-padded ones. All scratch memory, padding included, is taken
+     * from the current arena: binding a workspace (see Arena::Bind) spares
+     * the allocations of repeated products
+     *
+     * @param m                     Height of A and C
+     * @param n                     Width of B and C
+     * @param k                     Width of A and height of B
+     * @param a                     A operand
+     * @param lda                   Row stride of A
+     * @param b                     B operand
+     * @param ldb                   Row stride of B
+     * @param c                     C operand, overwritten with the result
+     * @param ldc                   Row stride of C
+     *
+     * @exception std::bad_alloc    Allocation failure
+     */
+    template < class T >
+    void multiply(const size_t& m, const size_t& n, const size_t& k,
+                  const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c, const size_t& ldc)
+    {
+        const size_t depth = levels(m, n, k);
+        const size_t unit = size_t(1) << depth;
+        const size_t pm = (m + unit - 1) / unit * unit;
+        const size_t pn = (n + unit - 1) / unit * unit;
+        const size_t pk = (k + unit - 1) / unit * unit;
+        if (pm == m && pn == n && pk == k)
+            return recurse(depth, m, n, k, a, lda, b, ldb, c, ldc);
+
+        maths::Scratch<T> pa(pm * pk), pb(pk * pn), pc(pm * pn);
+        const auto pad = [](const size_t& rows, const size_t& cols, const T* from, const size_t& ld,
+                            T* to, const size_t& prows, const size_t& pcols) {
+            for (size_t i = 0; i < prows; ++i)
+            {
+                T* target = to + i * pcols;
+                if (i < rows)
+                    std::copy(from + i * ld, from + i * ld + cols, target);
+                std::fill(target + (i < rows ? cols : 0), target + pcols, T());
+            }
+        };
+        pad(m, k, a, lda, pa.get(), pm, pk);
+        pad(k, n, b, ldb, pb.get(), pk, pn);
+        recurse(depth, pm, pn, pk, pa.get(), pk, pb.get(), pn, pc.get(), pn);
+        for (size_t i = 0; i < m; ++i)
+            std::copy(pc.get() + i * pn, pc.get() + i * pn + n, c + i * ldc);
+    }
+}
+}
+
+#endif //STRASSEN_HPP
@@ -0,0 +1,357 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - transpose.hpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [6:05 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#ifndef TRANSPOSE_HPP
+#define TRANSPOSE_HPP
+
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "simd.hpp"
+#include "ThreadPool.hpp"
+
+namespace maths
+{
+namespace transpose
+{
+    // Size of the square tiles the recursion stops at, small enough
+    // for a tile of the source and one of the destination to stay in L1
+    constexpr size_t TILE = 32;
+
+    // Amount of elements under which transpositions stay on a single thread
+    constexpr size_t PARALLEL_THRESHOLD = 256 * 256;
+
+    // Placeholder word of types which cannot be moved as raw bits
+    struct none {};
+
+    /**
+     * Word moved by the SIMD kernels in place of T: transposing only moves
+     * bits around, so any trivially copyable type of 4 or 8 bytes qualifies
+     *
+     * @tparam T    Element type
+     */
+    template < class T, class = void >
+    struct word { using type = none; };
+
+    template < class T >
+    struct word<T, typename std::enable_if<std::is_trivially_copyable<T>::value && sizeof(T) == 4>::type>
+        { using type = std::uint32_t; };
+
+    template < class T >
+    struct word<T, typename std::enable_if<std::is_trivially_copyable<T>::value && sizeof(T) == 8>::type>
+        { using type = std::uint64_t; };
+
+    /**
+     * In-register kernel, transposing a `width` x `width` block.
+     * Every row is loaded before anything is stored, so the source
+     * and the destination may be the same block
+     *
+     * @tparam W    Word type
+     */
+    template < class W >
+    struct kernel
+    {
+        size_t  width;  // Size of the block (0 when there is none)
+        void    (*block)(const W* src, const size_t& lds, W* dst, const size_t& ldd);
+    };
+
+#ifdef MATRIX_X86
+    /**
+     * SSE2 kernel, on a 4 x 4 block of 32-bit words
+     */
+    __attribute__((target("sse2")))
+    inline void block_sse2(const std::uint32_t* src, const size_t& lds, std::uint32_t* dst, const size_t& ldd)
+    {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + lds));
+        const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * lds));
+        const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * lds));
+
+        const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + ldd), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * ldd), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * ldd), _mm_unpackhi_epi64(t2, t3));
+    }
+
+    /**
+     * SSE2 kernel, on a 2 x 2 block of 64-bit words
+     */
+    __attribute__((target("sse2")))
+    inline void block_sse2(const std::uint64_t* src, const size_t& lds, std::uint64_t* dst, const size_t& ldd)
+    {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + lds));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi64(r0, r1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + ldd), _mm_unpackhi_epi64(r0, r1));
+    }
+
+    /**
+     * AVX2 kernel, on a 8 x 8 block of 32-bit words: pairs of rows are
+     * interleaved by 32 then 64 bits within each 128-bit lane,
+     * and lanes are finally exchanged across registers
+     */
+    __attribute__((target("avx2")))
+    inline void block_avx2(const std::uint32_t* src, const size_t& lds, std::uint32_t* dst, const size_t& ldd)
+    {
+        __m256i r[8];
+        for (size_t i = 0; i < 8; ++i)
+            r[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * lds));
+
+        __m256i t[8];
+        for (size_t i = 0; i < 8; i += 2)
+        {
+            t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+            t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+        }
+        for (size_t i = 0; i < 8; i += 4)
+        {
+            r[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+            r[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+            r[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+            r[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+        }
+        for (size_t i = 0; i < 4; ++i)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * ldd),
+                                _mm256_permute2x128_si256(r[i], r[i + 4], 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (i + 4) * ldd),
+                                _mm256_permute2x128_si256(r[i], r[i + 4], 0x31));
+        }
+    }
+
+    /**
+     * AVX2 kernel, on a 4 x 4 block of 64-bit words
+     */
+    __attribute__((target("avx2")))
+    inline void block_avx2(const std::uint64_t* src, const size_t& lds, std::uint64_t* dst, const size_t& ldd)
+    {
+        const __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        const __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + lds));
+        const __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * lds));
+        const __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 3 * lds));
+
+        const __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+        const __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+        const __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+        const __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_permute2x128_si256(t0, t2, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + ldd), _mm256_permute2x128_si256(t1, t3, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * ldd), _mm256_permute2x128_si256(t0, t2, 0x31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 3 * ldd), _mm256_permute2x128_si256(t1, t3, 0x31));
+    }
+#endif
+
+    /**
+     * Selects the widest kernel the running CPU supports for the given word
+     *
+     * @return                      Kernel (of width 0 when none applies)
+     */
+    template < class W >
+    const kernel<W>& select()
+    {
+        static const kernel<W> result = { 0, nullptr };
+        return result;
+    }
+
+#ifdef MATRIX_X86
+    template <>
+    inline const kernel<std::uint32_t>& select<std::uint32_t>()
+    {
+        static const kernel<std::uint32_t> result =
+            simd::level() >= simd::isa::avx2 ? kernel<std::uint32_t>{ 8, &block_avx2 } :
+            simd::level() >= simd::isa::sse2 ? kernel<std::uint32_t>{ 4, &block_sse2 } :
+            kernel<std::uint32_t>{ 0, nullptr };
+        return result;
+    }
+
+    template <>
+    inline const kernel<std::uint64_t>& select<std::uint64_t>()
+    {
+        static const kernel<std::uint64_t> result =
+            simd::level() >= simd::isa::avx2 ? kernel<std::uint64_t>{ 4, &block_avx2 } :
+            simd::level() >= simd::isa::sse2 ? kernel<std::uint64_t>{ 2, &block_sse2 } :
+            kernel<std::uint64_t>{ 0, nullptr };
+        return result;
+    }
+#endif
+
+    /**
+     * Transposes a m x n tile with the kernel, the borders it does not cover
+     * being moved one element at a time
+     */
+    template < class T, class W >
+    void tile(const size_t& m, const size_t& n, const T* src, const size_t& lds,
+              T* dst, const size_t& ldd, const kernel<W>& k)
+    {
+        const size_t full_m = k.width ? m - m % k.width : 0;
+        const size_t full_n = k.width ? n - n % k.width : 0;
+        for (size_t i = 0; i < full_m; i += k.width)
+            for (size_t j = 0; j < full_n; j += k.width)
+                k.block(reinterpret_cast<const W*>(src + i * lds + j), lds,
+                        reinterpret_cast<W*>(dst + j * ldd + i), ldd);
+
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = i < full_m ? full_n : 0; j < n; ++j)
+                dst[j * ldd + i] = src[i * lds + j];
+    }
+
+    /**
+     * Cache-oblivious transposition: halves the largest dimension
+     * (on a tile boundary) until reaching a single tile
+     */
+    template < class T, class W >
+    void recurse(const size_t& m, const size_t& n, const T* src, const size_t& lds,
+                 T* dst, const size_t& ldd, const kernel<W>& k)
+    {
+        if (m <= TILE && n <= TILE)
+            return tile(m, n, src, lds, dst, ldd, k);
+
+        if (m >= n)
+        {
+            const size_t half = (m / 2 + TILE - 1) / TILE * TILE;
+            recurse(half, n, src, lds, dst, ldd, k);
+            recurse(m - half, n, src + half * lds, lds, dst + half, ldd, k);
+        }
+        else
+        {
+            const size_t half = (n / 2 + TILE - 1) / TILE * TILE;
+            recurse(m, half, src, lds, dst, ldd, k);
+            recurse(m, n - half, src + half, lds, dst + half * ldd, ldd, k);
+        }
+    }
+
+    /**
+     * Writes the transpose of a m x n matrix into a n x m one, which must not overlap.
+     * Large matrices are split in strips of rows over the shared thread pool
+     *
+     * @param m                     Height of the source
+     * @param n                     Width of the source
+     * @param src                   Row-major source
+     * @param lds                   Row stride of the source
+     * @param dst                   Row-major destination
+     * @param ldd                   Row stride of the destination
+     */
+    template < class T >
+    void copy(const size_t& m, const size_t& n, const T* src, const size_t& lds, T* dst, const size_t& ldd)
+    {
+        using W = typename word<T>::type;
+        if (!m || !n)
+            return;
+        const kernel<W>& k = select<W>();
+
+        ThreadPool& pool = ThreadPool::global();
+        if (pool.size() == 1 || m * n < PARALLEL_THRESHOLD)
+            return recurse(m, n, src, lds, dst, ldd, k);
+
+        const size_t strips = std::min(pool.size() * 4, (m + TILE - 1) / TILE);
+        const size_t rows = ((m + strips - 1) / strips + TILE - 1) / TILE * TILE;
+        pool.parallel_for((m + rows - 1) / rows, [&](const size_t& strip) {
+            const size_t i = strip * rows;
+            recurse(std::min(rows, m - i), n, src + i * lds, lds, dst + i, ldd, k);
+        });
+    }
+
+    /**
+     * Exchanges a block with its mirror across the diagonal, both transposed
+     */
+    template < class W >
+    void swap_blocks(W* x, W* y, const size_t& ld, const kernel<W>& k)
+    {
+        W buffer[8 * 8];
+        k.block(x, ld, buffer, k.width);
+        k.block(y, ld, x, ld);
+        for (size_t i = 0; i < k.width; ++i)
+            std::copy(buffer + i * k.width, buffer + (i + 1) * k.width, y + i * ld);
+    }
+
+    /**
+     * Exchanges a rows x cols tile with its mirror across the diagonal,
+     * a cols x rows tile, both transposed
+     */
+    template < class T, class W >
+    void swap_tiles(const size_t& rows, const size_t& cols, T* x, T* y, const size_t& ld, const kernel<W>& k)
+    {
+        const size_t full_m = k.width ? rows - rows % k.width : 0;
+        const size_t full_n = k.width ? cols - cols % k.width : 0;
+        for (size_t i = 0; i < full_m; i += k.width)
+            for (size_t j = 0; j < full_n; j += k.width)
+                swap_blocks(reinterpret_cast<W*>(x + i * ld + j), reinterpret_cast<W*>(y + j * ld + i), ld, k);
+
+        for (size_t i = 0; i < rows; ++i)
+            for (size_t j = i < full_m ? full_n : 0; j < cols; ++j)
+                std::swap(x[i * ld + j], y[j * ld + i]);
+    }
+
+    /**
+     * Transposes a square tile on the diagonal in place
+     */
+    template < class T, class W >
+    void diagonal_tile(const size_t& size, T* a, const size_t& ld, const kernel<W>& k)
+    {
+        const size_t full = k.width ? size - size % k.width : 0;
+        for (size_t i = 0; i < full; i += k.width)
+        {
+            W* corner = reinterpret_cast<W*>(a + i * ld + i);
+            k.block(corner, ld, corner, ld);
+            for (size_t j = i + k.width; j < full; j += k.width)
+                swap_blocks(reinterpret_cast<W*>(a + i * ld + j), reinterpret_cast<W*>(a + j * ld + i), ld, k);
+        }
+
+        for (size_t i = 0; i < size; ++i)
+            for (size_t j = std::max(i + 1, i < full ? full : 0); j < size; ++j)
+                std::swap(a[i * ld + j], a[j * ld + i]);
+    }
+
+    /**
+     * Transposes a n x n matrix in place, exchanging tiles with their mirror
+     * across the diagonal. Large matrices spread rows of tiles over
+     * the shared thread pool
+     *
+     * @param n                     Size of the matrix
+     * @param a                     Row-major matrix
+     * @param lda                   Row stride of the matrix
+     */
+    template < class T >
+    void square(const size_t& n, T* a, const size_t& lda)
+    {
+        using W = typename word<T>::type;
+        if (n < 2)
+            return;
+        const kernel<W>& k = select<W>();
+
+        const size_t tiles = (n + TILE - 1) / TILE;
+        const auto row = [&](const size_t& ti) {
+            const size_t i = ti * TILE;
+            const size_t rows = std::min(TILE, n - i);
+            diagonal_tile(rows, a + i * lda + i, lda, k);
+            for (size_t j = i + TILE; j < n; j += TILE)
+                swap_tiles(rows, std::min(TILE, n - j), a + i * lda + j, a + j * lda + i, lda, k);
+        };
+
+        ThreadPool& pool = ThreadPool::global();
+        if (pool.size() == 1 || n * n < PARALLEL_THRESHOLD)
+            for (size_t ti = 0; ti < tiles; ++ti)
+                row(ti);
+        else
+            pool.parallel_for(tiles, row);
+    }
+}
+}
+
+#endif //TRANSPOSE_HPP
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - adopt.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [12:10 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <cmath>
+
+static size_t g_deleted = 0;
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Adopted arrays");
+
+        std::vector<float> values({ 1, 2, 3, 4, 5, 6 });
+        const float * storage = values.data();
+        const f32Matrix a(2, 3, std::move(values));
+        assert_eq(a.data() == storage);
+        assert_eq(!a.borrowed());
+        assert_eq((a == f32Matrix({ { 1, 2, 3 }, { 4, 5, 6 } })));
+
+        f32Matrix b = a;
+        assert_eq(b.data() != storage);
+        b += a;
+        assert_eq((b == f32Matrix({ { 2, 4, 6 }, { 8, 10, 12 } })));
+
+        std::vector<double> components({ 3, 4 });
+        const double * first = components.data();
+        const f64Vector v(std::move(components));
+        assert_eq(&v[0] == first);
+        assert_eq(v.norm_2() == 5);
+
+        assert_eq(throws<std::out_of_range>([]() { f32Matrix(2, 2, std::vector<float>({ 1, 2, 3 })); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Borrowed buffers");
+
+        // 3x3 matrix stored within rows of 5, the 2 extra columns belonging to the caller
+        float buffer[15];
+        for (size_t i = 0; i < 15; ++i)
+            buffer[i] = static_cast<float>(i);
+        {
+            f32Matrix a = f32Matrix::borrow(buffer, 3, 3, 5);
+            const f32Matrix expected({ { 0, 1, 2 }, { 5, 6, 7 }, { 10, 11, 12 } });
+            assert_eq(a.borrowed());
+            assert_eq(a.stride() == 5);
+            assert_eq((a == expected));
+
+            a += expected;
+            a *= .5f;
+            a -= f32Matrix(3, 3, 1);
+            assert_eq((a == expected - f32Matrix(3, 3, 1)));
+            assert_eq(buffer[3] == 3 && buffer[4] == 4 && buffer[8] == 8 && buffer[9] == 9);
+            assert_eq(buffer[11] == 10);
+
+            const f32Matrix copy = a;
+            assert_eq(!copy.borrowed() && copy.stride() == 3);
+            assert_eq((copy == a));
+            assert_eq((a * expected == copy * expected));
+            assert_eq((a.transpose() == copy.transpose()));
+
+            f32Matrix moved = std::move(a);
+            assert_eq(moved.borrowed() && moved.data() == buffer);
+            moved = maths::lazy(copy) * 2.f;
+            assert_eq(moved.borrowed() && buffer[0] == -2);
+            moved = f32Matrix(2, 2);
+            assert_eq(!moved.borrowed());
+        }
+        assert_eq(buffer[14] == 14);
+
+        double rhs[] = { 1, -1, 2, -1, 3, -1 };
+        f64Vector b = f64Vector::borrow(rhs, 3, 2);
+        f64Matrix({ { 2, 0, 0 }, { 0, 4, 0 }, { 0, 0, 6 } }).lu().solve_inplace(b);
+        assert_eq(rhs[0] == .5 && rhs[2] == .5 && rhs[4] == .5);
+        assert_eq(rhs[1] == -1 && rhs[3] == -1 && rhs[5] == -1);
+
+        assert_eq(throws<std::logic_error>([&buffer]() { f32Matrix::borrow(buffer, 3, 5, 4); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Adopted buffers");
+
+        const auto deleter = [](double * data) { ++g_deleted; delete[] data; };
+        {
+            double * data = new double[8]();
+            f64Matrix a = f64Matrix::adopt(data, 2, 3, 4, deleter);
+            assert_eq(!a.borrowed() && a.data() == data);
+            a.at(1, 2) = 7;
+            assert_eq(data[6] == 7);
+
+            f64Matrix b = std::move(a);
+            assert_eq(g_deleted == 0);
+            b = f64Matrix(1, 1);
+            assert_eq(g_deleted == 1);
+
+            f64Vector v = f64Vector::adopt(new double[3](), 3, 1, deleter);
+            v[2] = 1;
+            assert_eq(v.norm_1() == 1);
+        }
+        assert_eq(g_deleted == 2);
+
+        results();
+    }
+}
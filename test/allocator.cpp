@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - allocator.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [9:05 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <cmath>
+#include <cstdint>
+
+static size_t g_live = 0;
+
+template < class T >
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template < class U >
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(const size_t& count)
+    {
+        ++g_live;
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* data, const size_t&)
+    {
+        --g_live;
+        ::operator delete(data);
+    }
+};
+
+template < class T, class U >
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+
+template < class T, class U >
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+template < class K, class A >
+bool aligned(const Matrix<K, A>& matrix, const size_t& alignment)
+    { return !(reinterpret_cast<std::uintptr_t>(matrix.data()) % alignment); }
+
+template < class K, class A, class B >
+bool same(const Matrix<K, A>& a, const Matrix<K, B>& b)
+{
+    if (a.shape() != b.shape())
+        return false;
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            if (std::abs(a.at(m, n) - b.at(m, n)) > static_cast<K>(1e-3))
+                return false;
+    return true;
+}
+
+int main()
+{
+    using Padded = maths::PaddedAllocator<float>;
+
+    {
+        title("Aligned storage");
+
+        assert_eq(aligned(f32Matrix(3, 5), 64));
+        assert_eq(aligned(f64Matrix(17, 1), 64));
+        assert_eq(aligned(Matrix<double>(130, 130).transpose(), 64));
+        assert_eq((aligned(Matrix<float, maths::AlignedAllocator<float, 32>>(3, 3), 32)));
+        assert_eq(f32Matrix(5, 7).stride() == 7);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Padded rows");
+
+        const Matrix<float, Padded> a = sequence<float, Padded>(37, 37, 0, 37);
+        const Matrix<float, Padded> b = sequence<float, Padded>(37, 37, 0, 37).transpose();
+        const f32Matrix da = sequence<float, maths::AlignedAllocator<float>>(37, 37, 0, 37);
+        const f32Matrix db = sequence<float, maths::AlignedAllocator<float>>(37, 37, 0, 37).transpose();
+
+        assert_eq(a.stride() == 48);
+        assert_eq(aligned(a, 64));
+        assert_eq((Matrix<float, Padded>(1, 37).stride() == 37));
+        assert_eq((Matrix<float, Padded>(37, 1).stride() == 1));
+        assert_eq(same(a, da));
+        assert_eq(same(b, db));
+        assert_eq(same(Matrix<float, Padded>(a + b), f32Matrix(da + db)));
+        assert_eq(same(Matrix<float, Padded>(a * 2.f), f32Matrix(da * 2.f)));
+        assert_eq(same(a * b, da * db));
+        assert_eq(same(a.transpose(), da.transpose()));
+        assert_eq((a == Matrix<float, Padded>(a)));
+        assert_eq((a != b));
+        assert_eq((sequence<float, Padded>(16, 16, 0, 16).determinant()
+                   == sequence<float, maths::AlignedAllocator<float>>(16, 16, 0, 16).determinant()));
+        assert_eq(same(a.inverse(), da.inverse()));
+        assert_eq(same(solve(a, b), solve(da, db)));
+
+        Matrix<float, Padded> c = a;
+        c.transpose_inplace();
+        assert_eq(same(c, da.transpose()));
+        c += b;
+        assert_eq(same(c, f32Matrix(da.transpose() + db)));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Custom allocator");
+
+        using Counted = Matrix<double, CountingAllocator<double>>;
+        {
+            Counted a = sequence<double, CountingAllocator<double>>(20, 20, 0, 20);
+            Counted b = a;
+            assert_eq(g_live == 2);
+            Counted c = std::move(b);
+            assert_eq(g_live == 2);
+            b = a * c;
+            assert_eq(same(b, f64Matrix(sequence<double, maths::AlignedAllocator<double>>(20, 20, 0, 20)
+                                       * sequence<double, maths::AlignedAllocator<double>>(20, 20, 0, 20))));
+            Vector<double, CountingAllocator<double>> v(20);
+            assert_eq(g_live == 4);
+        }
+        assert_eq(g_live == 0);
+
+        results();
+    }
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - arena.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [10:15 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <new>
+#include <cstdlib>
+#include <cstdint>
+
+static size_t g_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++g_allocations;
+    if (void* data = std::malloc(size ? size : 1))
+        return data;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* data) noexcept
+    { std::free(data); }
+
+/**
+ * Counts the heap allocations done by the given call
+ */
+template < class F >
+size_t allocations(const F& call)
+{
+    const size_t before = g_allocations;
+    call();
+    return g_allocations - before;
+}
+
+int main()
+{
+    {
+        title("Arena");
+
+        maths::Arena arena;
+        void* first;
+        {
+            maths::Arena::Scope scope(arena);
+            first = arena.allocate(100);
+            assert_eq(!(reinterpret_cast<std::uintptr_t>(first) % maths::Arena::ALIGNMENT));
+            {
+                maths::Arena::Scope inner(arena);
+                assert_eq(arena.allocate(10) != first);
+                arena.allocate(2 * maths::Arena::MIN_BLOCK);
+                assert_eq(arena.capacity() > maths::Arena::MIN_BLOCK);
+            }
+            void* second = arena.allocate(10, 8);
+            arena.deallocate(second, 10);
+            assert_eq(arena.allocate(10, 8) == second);
+        }
+        assert_eq(arena.used() == 0);
+        assert_eq(allocations([&arena]() {
+            maths::Arena::Scope scope(arena);
+            arena.allocate(2 * maths::Arena::MIN_BLOCK);
+            arena.allocate(100);
+        }) == 0);
+
+        {
+            maths::Scratch<double> scratch(1000, arena);
+            scratch[999] = 1.;
+            assert_eq(arena.used() >= 1000 * sizeof(double));
+        }
+        assert_eq(arena.used() == 0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Steady state");
+
+        const f64Matrix a = sequence<double>(150, 150, 0, 150);
+        const f32Matrix b = sequence<float>(40, 40, 0, 40);
+        const Matrix<int> c = sequence<int>(7, 7, 0, 7);
+        f32Matrix singular({ { 1, 2, 3, 4 }, { 2, 4, 6, 8 }, { 1, 0, 1, 0 }, { 0, 1, 1, 2 } });
+        const f32Matrix cofactor = singular.cofactor();
+
+        a.determinant();
+        b.determinant();
+        c.determinant();
+        assert_eq(allocations([&a]() { a.determinant(); }) == 0);
+        assert_eq(allocations([&b]() { b.determinant(); }) == 0);
+        assert_eq(allocations([&c]() { c.determinant(); }) == 0);
+        // Only the copy and the result, minors being scratch ones
+        assert_eq(allocations([&singular]() { singular.cofactor(); }) == 2);
+        assert_eq(singular.cofactor() == cofactor);
+        assert_eq(c.determinant() == static_cast<int>(f64Matrix(sequence<double>(7, 7, 0, 7)).determinant() + .5));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Caller workspace");
+
+        static char buffer[1 << 20];
+        maths::Arena workspace(buffer, sizeof(buffer));
+        const f64Matrix a = sequence<double>(100, 100, 0, 100);
+        const double expected = a.determinant();
+        {
+            maths::Arena::Bind bind(workspace);
+            assert_eq(&maths::Arena::current() == &workspace);
+            double det = 0.;
+            assert_eq(allocations([&a, &det]() { det = a.determinant(); }) == 0);
+            assert_eq(det == expected);
+            assert_eq(workspace.capacity() == sizeof(buffer));
+            assert_eq(workspace.used() == 0);
+        }
+        assert_eq(&maths::Arena::current() == &maths::Arena::local());
+
+        results();
+    }
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - bareiss.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [11:05 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+
+/**
+ * Builds `L * U`, of a unit lower L and an upper U of the given diagonal,
+ * which determinant is the product of that diagonal. Off-diagonal elements
+ * are scaled by `spread`, so that the elements of the product get large
+ * while its determinant stays small
+ */
+template < class K >
+Matrix<K> product(const size_t& size, const K& spread, const K * diagonal)
+{
+    Matrix<K> lower(size, size), upper(size, size);
+    for (size_t m = 0; m < size; ++m)
+        for (size_t n = 0; n < size; ++n)
+        {
+            const K value = static_cast<K>(static_cast<long long>((m * 7 + n * 13) % 11) - 5) * spread;
+            if (m > n)
+                lower.at(m, n) = value;
+            else if (m < n)
+                upper.at(m, n) = value;
+        }
+    for (size_t i = 0; i < size; ++i)
+    {
+        lower.at(i, i) = 1;
+        upper.at(i, i) = diagonal[i];
+    }
+    return lower * upper;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Determinant");
+
+        const int diagonal[] = { 3, -1, 2, 1, -2, 1, 1, 5, 1, -1, 1, 1 };
+        const i32Matrix a = product<int>(12, 1, diagonal);
+        assert_eq(a.determinant() == 3 * -1 * 2 * -2 * 5 * -1);
+
+        // Rows swapped, odd then even times
+        i32Matrix b = a;
+        b.swap_rows(0, 5);
+        assert_eq(b.determinant() == -a.determinant());
+        b.swap_rows(2, 7);
+        assert_eq(b.determinant() == a.determinant());
+
+        // Zero leading pivot, and singular matrices
+        assert_eq(i64Matrix({ { 0, 2, 1, 0 }, { 1, 1, 0, 0 }, { 0, 0, 3, 1 }, { 1, 0, 0, 2 } }).determinant() == -11);
+        assert_eq(i64Matrix({ { 1, 2, 3, 4 }, { 2, 4, 6, 8 }, { 1, 0, 1, 0 }, { 0, 1, 1, 2 } }).determinant() == 0);
+
+        // Minors over 32 bits fit in the 64-bit products, up to the type's limits
+        const i32Matrix large({ { 46340, 1, 0, 0 }, { 0, 46340, 1, 0 }, { 0, 0, 1, 1 }, { 1, 0, 0, 1 } });
+        assert_eq(large.determinant() == 2147395599);
+        assert_eq(throws<std::overflow_error>([]() {
+            i32Matrix({ { 46341, 1, 0, 0 }, { 0, 46341, 1, 0 }, { 0, 0, 1, 1 }, { 1, 0, 0, 1 } }).determinant();
+        }));
+
+        // Unsigned matrices, as long as no minor is negative
+        assert_eq(u32Matrix({ { 2, 1, 0, 0 }, { 1, 2, 1, 0 }, { 0, 1, 2, 1 }, { 0, 0, 1, 2 } }).determinant() == 5);
+        assert_eq(throws<std::overflow_error>([]() {
+            u32Matrix({ { 0, 1, 0, 0 }, { 1, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } }).determinant();
+        }));
+
+#ifdef MATRIX_INT128
+        // Products beyond 64 bits, with minors and a determinant within them
+        const long long wide[] = { 7, 1, -1, 2, 1, 1, -3, 1 };
+        const i64Matrix huge = product<long long>(8, 100000000, wide);
+        assert_eq(huge.determinant() == 7 * -1 * 2 * -3);
+#endif
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Rank and echelon form");
+
+        const int diagonal[] = { 3, -1, 2, 1, 0, 1, 1, 5, 1, -1, 1, 1 };
+        assert_eq(product<int>(12, 1, diagonal).rank() == 11);
+        assert_eq(i64Matrix({ { 2, 4, 6 }, { 1, 2, 3 }, { 0, 0, 0 }, { 3, 6, 10 } }).rank() == 2);
+        assert_eq(i32Matrix(3, 5).rank() == 0);
+
+        // Integral reduced forms are found exactly
+        assert_eq((i32Matrix({ { 2, 4 }, { 1, 3 } }).row_echelon() == i32Matrix({ { 1, 0 }, { 0, 1 } })));
+        assert_eq((i32Matrix({ { 0, 3, 6 }, { 2, 4, 2 }, { 1, 2, 1 } }).row_echelon()
+            == i32Matrix({ { 1, 0, -3 }, { 0, 1, 2 }, { 0, 0, 0 } })));
+
+        // Others as their smallest integer multiples, where truncated divisions used to lose them
+        assert_eq((i32Matrix({ { 2, 1, 1 }, { 0, 2, 1 } }).row_echelon() == i32Matrix({ { 4, 0, 1 }, { 0, 2, 1 } })));
+        assert_eq((i64Matrix({ { -3, 2 }, { 6, -4 } }).row_echelon() == i64Matrix({ { 3, -2 }, { 0, 0 } })));
+
+        results();
+    }
+}
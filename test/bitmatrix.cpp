@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - bitmatrix.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [1:45 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <BitMatrix.hpp>
+
+/**
+ * Builds a pseudo-random bit matrix, with about one bit out of `spread` set
+ */
+BitMatrix scattered(const size_t& height, const size_t& width, const size_t& spread, size_t seed)
+{
+    BitMatrix result(height, width);
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (!((seed >> 33) % spread))
+                result.flip(m, n);
+        }
+    return result;
+}
+
+/**
+ * Builds `L * D * U`, of unit triangular L and U, and a diagonal D holding
+ * `rank` ones: a matrix of that rank exactly
+ */
+BitMatrix ranked(const size_t& size, const size_t& rank, const size_t& seed)
+{
+    BitMatrix lower = scattered(size, size, 2, seed), upper = scattered(size, size, 2, seed + 1);
+    BitMatrix diagonal(size, size);
+    for (size_t m = 0; m < size; ++m)
+    {
+        for (size_t n = 0; n < size; ++n)
+        {
+            lower.set(m, n, m == n || (m > n && lower.at(m, n)));
+            upper.set(m, n, m == n || (m < n && upper.at(m, n)));
+        }
+        diagonal.set(m, m, m < rank);
+    }
+    return lower * diagonal * upper;
+}
+
+/**
+ * Checks a product against the parities of the integer one
+ */
+bool check_product(const BitMatrix& a, const BitMatrix& b)
+{
+    const BitMatrix c = a * b;
+    const i64Matrix expected = a.to_matrix<long long>() * b.to_matrix<long long>();
+    for (size_t m = 0; m < c.height(); ++m)
+        for (size_t n = 0; n < c.width(); ++n)
+            if (c.at(m, n) != static_cast<bool>(expected.at(m, n) % 2))
+                return false;
+    return true;
+}
+
+/**
+ * Checks the reduced row echelon form: leading ones, alone in their columns,
+ * and rows spanning the same space as the original ones
+ */
+bool check_echelon(const BitMatrix& a)
+{
+    const BitMatrix r = a.row_echelon();
+    const size_t rank = a.rank();
+    size_t column = 0;
+    for (size_t m = 0; m < a.height(); ++m)
+    {
+        while (column < a.width() && !r.at(m, column))
+            ++column;
+        if ((m < rank) != (column < a.width()))
+            return false;
+        if (m >= rank)
+            continue;
+        for (size_t i = 0; i < a.height(); ++i)
+            if (i != m && r.at(i, column))
+                return false;
+    }
+
+    BitMatrix stacked(2 * a.height(), a.width());
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+        {
+            stacked.set(m, n, a.at(m, n));
+            stacked.set(a.height() + m, n, r.at(m, n));
+        }
+    return stacked.rank() == rank;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Storage");
+
+        const i32Matrix dense({ { 1, 0, 3 }, { 0, 0, -1 } });
+        BitMatrix a(dense);
+        assert_eq(a.at(0, 0) && !a.at(0, 1) && a.at(0, 2) && a.at(1, 2) && a.count() == 3);
+        assert_eq((a.to_matrix() == i32Matrix({ { 1, 0, 1 }, { 0, 0, 1 } })));
+        assert_eq(a.stride() == 8);
+
+        a.xor_row(1, 0);
+        assert_eq(a.at(1, 0) && !a.at(1, 2));
+        a.swap_rows(0, 1);
+        assert_eq(!a.at(0, 2) && a.at(1, 2));
+        a.set(1, 1, true);
+        a.flip(1, 1);
+        assert_eq(!a.at(1, 1));
+        assert_eq(throws<std::out_of_range>([&]() { a.at(2, 0); }));
+
+        // Across words, and back
+        const BitMatrix b = scattered(130, 70, 3, 1);
+        const BitMatrix t = b.transpose();
+        bool transposed = t.shape() == std::make_pair<size_t, size_t>(70, 130);
+        for (size_t m = 0; m < b.height(); ++m)
+            for (size_t n = 0; n < b.width(); ++n)
+                transposed = transposed && t.at(n, m) == b.at(m, n);
+        assert_eq(transposed && t.transpose() == b);
+        assert_eq(BitMatrix(b.to_matrix<double>()) == b);
+        assert_eq((b + b).count() == 0 && b + BitMatrix(130, 70) == b);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Products");
+
+        assert_eq(check_product(scattered(5, 3, 2, 2), scattered(3, 7, 2, 3)));
+        assert_eq(check_product(scattered(100, 150, 2, 4), scattered(150, 70, 2, 5)));
+        // Deeper than a chunk of words, and against a single column
+        assert_eq(check_product(scattered(40, 4200, 2, 6), scattered(4200, 65, 2, 7)));
+        assert_eq(check_product(scattered(300, 200, 5, 8), scattered(200, 1, 2, 9)));
+
+        const BitMatrix a = scattered(90, 90, 2, 10);
+        assert_eq(a * BitMatrix::identity(90) == a && BitMatrix::identity(90) * a == a);
+        assert_eq(throws<std::logic_error>([&]() { a * BitMatrix(89, 3); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Elimination");
+
+        // Independent over the integers, not over GF(2)
+        const i32Matrix dense({ { 1, 1, 0 }, { 0, 1, 1 }, { 1, 0, 1 } });
+        assert_eq(dense.rank() == 3 && BitMatrix(dense).rank() == 2 && !BitMatrix(dense).determinant());
+        assert_eq(BitMatrix::identity(70).determinant() && BitMatrix(4, 9).rank() == 0);
+
+        assert_eq(ranked(200, 200, 11).rank() == 200 && ranked(200, 137, 12).rank() == 137);
+        assert_eq(ranked(130, 0, 13).rank() == 0);
+        assert_eq(check_echelon(ranked(150, 93, 14)) && check_echelon(scattered(40, 300, 2, 15)));
+        assert_eq(check_echelon(scattered(300, 40, 7, 16)) && check_echelon(BitMatrix(3, 5)));
+
+        // Sparse parity checks: columns without pivots, pivots found far below
+        assert_eq(check_echelon(scattered(260, 520, 40, 17)));
+
+        results();
+    }
+}
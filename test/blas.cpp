@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - blas.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [9:20 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <blas.hpp>
+#include <cmath>
+#include <vector>
+#include <limits>
+
+bool close(const double& a, const double& b)
+    { return std::abs(a - b) <= 1e-5 * (1 + std::abs(b)); }
+
+/**
+ * Checks every reduction against plain loops in doubles, over contiguous
+ * and strided elements
+ */
+template < class K >
+bool check(const size_t& count, const size_t& step)
+{
+    const Matrix<K> xs = sequence<K>(1, count * step, 1), ys = sequence<K>(1, count * step, 2);
+    const K* x = xs.data();
+    const K* y = ys.data();
+
+    double dot = 0, sum = 0, asum = 0, squares = 0, largest = 0;
+    size_t index = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double value = static_cast<double>(x[i * step]);
+        dot += value * static_cast<double>(y[i * step]);
+        sum += value;
+        asum += std::abs(value);
+        squares += value * value;
+        if (std::abs(value) > largest)
+        {
+            largest = std::abs(value);
+            index = i;
+        }
+    }
+    return close(static_cast<double>(maths::blas::dot(count, x, step, y, step)), dot)
+        && close(static_cast<double>(maths::blas::sum(count, x, step)), sum)
+        && close(static_cast<double>(maths::blas::asum(count, x, step)), asum)
+        && close(static_cast<double>(maths::blas::nrm2(count, x, step)), std::sqrt(squares))
+        && static_cast<double>(maths::blas::amax(count, x, step)) == largest
+        && maths::blas::iamax(count, x, step) == index;
+}
+
+int main()
+{
+    {
+        title("Reductions");
+
+        // Around vector widths, blocks, and parallel chunks
+        for (const size_t count : { 0, 1, 5, 64, 1023, 1025, 5000, 1100000 })
+            assert_eq(check<float>(count, 1) && check<double>(count, 1) && check<int>(count, 1));
+        assert_eq(check<float>(3001, 3) && check<double>(70000, 2));
+
+        // Floats are only summed by blocks before the accumulator type takes over,
+        // where a float running sum would drift by about 1%
+        const std::vector<float> tenths(1 << 20, .1f);
+        const double exact = static_cast<double>(.1f) * static_cast<double>(tenths.size());
+        assert_eq(std::abs(maths::blas::sum(tenths.size(), tenths.data(), 1) - exact) < 1e-6 * exact);
+
+        // First of equal magnitudes, negative ones included
+        const std::vector<double> ties = { 1, -7, 3, 7, -7 };
+        assert_eq(maths::blas::iamax(ties.size(), ties.data(), 1) == 1);
+        assert_eq(maths::blas::iamax(0, ties.data(), 1) == 0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Scaled norms");
+
+        const f64Vector huge({ 3e300, -4e300 });
+        assert_eq(std::abs(huge.norm_2() / 5e300 - 1) < 1e-15);
+        const f64Vector tiny({ 3e-300, 4e-300, 0 });
+        assert_eq(std::abs(tiny.norm_2() / 5e-300 - 1) < 1e-15);
+        const f32Vector large({ 3e37f, 4e37f });
+        assert_eq(std::abs(large.norm_2() / 5e37 - 1) < 1e-6);
+        const f64Vector infinite({ 1, std::numeric_limits<double>::infinity() });
+        assert_eq(std::isinf(infinite.norm_2()));
+
+        const f64Vector v({ -3, 4, 0, -12 });
+        assert_eq(v.norm_1() == 19 && v.norm_2() == 13 && v.norm_inf() == 12);
+        assert_eq(v.dot(v) == 169);
+        const i32Vector w({ -3, 4, 0, -12 });
+        assert_eq(w.norm_1() == 19 && w.norm_2() == 13 && w.norm_inf() == 12);
+
+        results();
+    }
+}
@@ -16,5 +16,47 @@
 #include <Matrix.hpp>
 #include <Vector.hpp>
 #include <maths.hpp>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Converts a pseudo-random value into a small integer in [-8, 8],
+ * exact in every arithmetic type
+ */
+template < class K >
+K sequence_value(const uint64_t& value, std::true_type)
+    { return static_cast<K>(static_cast<long long>(value % 17) - 8); }
+
+/**
+ * Converts a pseudo-random value as a whole, for the other types
+ * (such as Modular)
+ */
+template < class K >
+K sequence_value(const uint64_t& value, std::false_type)
+    { return K(value); }
+
+/**
+ * Builds a pseudo-random matrix, the same for a given seed (see
+ * sequence_value()), with an amount added along its diagonal
+ *
+ * @param height                Height of the matrix
+ * @param width                 Width of the matrix
+ * @param seed                  Seed of the values
+ * @param diagonal              Amount added to the diagonal elements
+ * @return                      Matrix of pseudo-random values
+ */
+template < class K, class A = maths::AlignedAllocator<K> >
+Matrix<K, A> sequence(const size_t& height, const size_t& width, const size_t& seed = 0, const K& diagonal = K())
+{
+    Matrix<K, A> result(height, width);
+    uint64_t state = seed;
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            result.at(m, n) = sequence_value<K>(state >> 11, std::is_arithmetic<K>()) + (m == n ? diagonal : K());
+        }
+    return result;
+}
 
 #endif //COMMON_HPP
\ No newline at end of file
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - expression.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [3:10 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <type_traits>
+
+static size_t g_allocations = 0;
+
+template < class T >
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template < class U >
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(const size_t& count)
+    {
+        ++g_allocations;
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* data, const size_t&)
+        { ::operator delete(data); }
+};
+
+template < class T, class U >
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+
+template < class T, class U >
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+/**
+ * Builds a matrix of distinct values, shifted by the given offset
+ */
+f64Matrix ramp(const size_t& height, const size_t& width, const double& offset)
+{
+    f64Matrix result(height, width);
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+            result.at(m, n) = static_cast<double>(m * width + n) * .5 + offset;
+    return result;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Adds two matrices which only live within this call
+ */
+f64Matrix scoped_sum()
+{
+    const f64Matrix a = ramp(3, 3, 1), b = ramp(3, 3, 2);
+    auto c = a + b;
+    return c;
+}
+
+int main()
+{
+    {
+        title("Eager operators");
+
+        const f64Matrix a = ramp(3, 3, 1), b = ramp(3, 3, -4);
+        assert_eq((std::is_same<decltype(a + b), f64Matrix>::value));
+        assert_eq((std::is_same<decltype(a * 2.), f64Matrix>::value && std::is_same<decltype(2. * a), f64Matrix>::value));
+        assert_feq((a + b).trace(), a.trace() + b.trace());
+        assert_eq((a - b).transpose() == a.transpose() - b.transpose());
+        assert_eq(scoped_sum() == ramp(3, 3, 1) + ramp(3, 3, 2));
+        assert_eq(throws<std::logic_error>([&]() { a + f64Matrix(3, 2); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Fused chains");
+
+        const f64Matrix a = ramp(70, 45, 1), b = ramp(70, 45, -3), d = ramp(70, 45, 7);
+        const f64Matrix fused = maths::lazy(a) + maths::lazy(b) * 2. - d;
+        assert_eq(fused == a + b * 2. - d);
+        assert_eq((maths::lazy(a) + b) == a + b && (maths::lazy(a) - b) != a + b);
+        assert_eq((maths::lazy(a) - b).eval().transpose() == (a - b).transpose());
+        assert_eq((maths::lazy(a) * 3.).eval() == 3. * a);
+
+        f64Matrix c = a;
+        c += maths::lazy(b) * 2. - d;
+        assert_eq(c == fused);
+        assert_eq(throws<std::logic_error>([&]() { maths::lazy(a) + f64Matrix(45, 70); }));
+        assert_eq(throws<std::logic_error>([&]() { c -= maths::lazy(a) - ramp(70, 44, 0); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Aliasing");
+
+        const f64Matrix b = ramp(33, 17, 5);
+        f64Matrix a = ramp(33, 17, 1);
+        const f64Matrix original = a;
+
+        a = a + b;
+        assert_eq(a == original + b);
+        a = maths::lazy(a) - b;
+        assert_eq(a == original);
+        a = maths::lazy(b) + a;
+        assert_eq(a == original + b);
+        a = maths::lazy(b) - a;
+        assert_eq(a == b - (original + b));
+        a = maths::lazy(a) * -1. + a + b;
+        assert_eq(a == b);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Vector expressions");
+
+        const f64Vector u({ 1, 2, 3, 4, 5 }), v({ -2, .5, 8, 0, 1 });
+        assert_eq((std::is_same<decltype(u + v), f64Vector>::value));
+        assert_feq((u + v).dot(u), u.dot(u) + v.dot(u));
+
+        const f64Vector w = maths::lazy(u) + v * 2.;
+        assert_eq(w == f64Vector({ -3, 3, 19, 4, 7 }));
+        f64Vector x = u;
+        x -= maths::lazy(v) * 3. - u;
+        assert_eq(x == f64Vector({ 8, 2.5, -18, 8, 7 }));
+        assert_eq(throws<std::logic_error>([&]() { maths::lazy(u) + f64Vector(4); }));
+
+        // Interpolations only allocate their result
+        using Counted = Vector<double, CountingAllocator<double>>;
+        const Counted from({ 1, 2, 3, 4, 5 }), to({ 3, -2, 3, 8, 0 });
+        g_allocations = 0;
+        const Counted middle = lerp(from, to, .25f);
+        assert_eq(g_allocations == 1 && middle == Counted({ 1.5, 1, 3, 5, 3.75 }));
+        using CountedMatrix = Matrix<double, CountingAllocator<double>>;
+        const CountedMatrix a({ { 1, 2 }, { 3, 4 } }), b({ { -3, 2 }, { 7, 0 } });
+        g_allocations = 0;
+        const CountedMatrix blend = lerp(a, b, .5f);
+        assert_eq(g_allocations == 1 && blend == CountedMatrix({ { -1, 2 }, { 5, 2 } }));
+
+        results();
+    }
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - file.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [1:40 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <MatrixFile.hpp>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+static const char * const PATH = "unit_test.mtrx";
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Saving and loading");
+
+        const f64Matrix a = sequence<double>(37, 23);
+        maths::file::save(PATH, a);
+        assert_eq(maths::file::load<double>(PATH) == a);
+
+        float buffer[15];
+        for (size_t i = 0; i < 15; ++i)
+            buffer[i] = static_cast<float>(i);
+        maths::file::save(PATH, f32Matrix::borrow(buffer, 3, 3, 5), 4096);
+        assert_eq((maths::file::load<float>(PATH) == f32Matrix({ { 0, 1, 2 }, { 5, 6, 7 }, { 10, 11, 12 } })));
+        std::ifstream in(PATH, std::ios::binary | std::ios::ate);
+        assert_eq(static_cast<size_t>(in.tellg()) == 4096 + 9 * sizeof(float));
+        in.close();
+
+        maths::file::save(PATH, Matrix<int>(0, 4));
+        assert_eq(maths::file::load<int>(PATH).shape() == i32Matrix(0, 4).shape());
+
+        assert_eq(throws<std::logic_error>([]() { maths::file::load<float>(PATH); }));
+        assert_eq(throws<std::logic_error>([]() { maths::file::save(PATH, f32Matrix(2, 2), 48); }));
+        assert_eq(throws<std::system_error>([]() { maths::file::load<float>("missing/unit_test.mtrx"); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Mapping");
+
+        const f32Matrix a = sequence<float>(300, 129);
+        maths::file::save(PATH, a);
+        {
+            // Read-only mappings are constant views, which keep the mapping alive
+            const maths::file::Mapping<float> mapping = maths::file::view<float>(PATH, maths::file::Advice::sequential);
+            const MatrixView<const float> mapped = mapping.view();
+            assert_eq(mapped == a);
+            assert_eq(!(reinterpret_cast<std::uintptr_t>(mapped.data()) % 64));
+            maths::file::prefetch(mapped, 100, 500);
+            assert_eq(mapped * MatrixView<const float>(a.transpose()) == a * a.transpose());
+            assert_eq((std::is_same<decltype(mapped.at(0, 0)), const float&>::value));
+
+            const maths::file::Mapping<float> copy = mapping;
+            f32Matrix values = copy.view().eval();
+            values += a;
+            values.transpose_inplace();
+            assert_eq(values == (a * 2.f).transpose() && copy.view().row(299) == a.row(299));
+            assert_eq(throws<std::logic_error>([]() { maths::file::map<float>(PATH, maths::file::Mode::read_only); }));
+        }
+        {
+            f32Matrix mapped = maths::file::map<float>(PATH, maths::file::Mode::copy_on_write);
+            mapped.at(0, 0) = 42;
+            assert_eq(mapped.at(0, 0) == 42);
+            assert_eq(maths::file::load<float>(PATH) == a);
+        }
+        {
+            f32Matrix mapped = maths::file::map<float>(PATH, maths::file::Mode::read_write,
+                                                       maths::file::Advice::willneed);
+            mapped.row(1).fill(-1);
+            f32Matrix moved = std::move(mapped);
+            moved.at(2, 0) = -2;
+        }
+        const f32Matrix written = maths::file::load<float>(PATH);
+        assert_eq(written.at(1, 128) == -1 && written.at(2, 0) == -2 && written.at(2, 1) == a.at(2, 1));
+        assert_eq(maths::file::map<float>(PATH).at(1, 0) == -1 && maths::file::view<float>(PATH).view().at(1, 0) == -1);
+
+        assert_eq(throws<std::logic_error>([]() { maths::file::map<double>(PATH); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Out-of-core products");
+
+        const char * const lhs = "unit_test_lhs.mtrx";
+        const char * const rhs = "unit_test_rhs.mtrx";
+        const f64Matrix a = sequence<double>(130, 300) * .01;
+        const f64Matrix b = sequence<double>(300, 70) * -.02;
+        maths::file::save(lhs, a);
+        maths::file::save(rhs, b);
+
+        // Tiles of 6 x 256 by 256 x 8, the depth being split in two
+        maths::file::multiply<double>(lhs, rhs, PATH, 64 * 1024);
+        assert_eq(maths::file::load<double>(PATH) == a * b);
+        maths::file::multiply<double>(lhs, rhs, PATH, 64 * 1024 * 1024);
+        assert_eq(maths::file::map<double>(PATH) == a * b);
+
+        const f32Matrix c = sequence<float>(50, 41) * .5f;
+        maths::file::save(lhs, c);
+        maths::file::save(rhs, c.transpose());
+        maths::file::multiply<float>(lhs, rhs, PATH, 100 * 1024);
+        assert_eq(maths::file::load<float>(PATH) == c * c.transpose());
+
+        assert_eq(throws<std::logic_error>([&]() { maths::file::multiply<float>(lhs, lhs, PATH, 1 << 20); }));
+        assert_eq(throws<std::logic_error>([&]() { maths::file::multiply<float>(lhs, rhs, PATH, 1024); }));
+        assert_eq(throws<std::logic_error>([&]() { maths::file::multiply<double>(lhs, rhs, PATH, 1 << 20); }));
+
+        std::remove(lhs);
+        std::remove(rhs);
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Foreign files");
+
+        // Hand-written column-major file of 2x3 values, as other tools may produce
+        maths::file::Header header = maths::file::Header();
+        std::memcpy(header.magic, "MTRX", 4);
+        header.version = maths::file::VERSION;
+        header.byte_order = maths::file::BYTE_ORDER_MARK;
+        header.dtype = maths::file::DType::int32;
+        header.layout = maths::file::Layout::column_major;
+        header.height = 2;
+        header.width = 3;
+        header.stride = 2;
+        header.offset = sizeof(header);
+        const std::int32_t values[] = { 1, 4, 2, 5, 3, 6 };
+        {
+            std::ofstream out(PATH, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(values), sizeof(values));
+        }
+        assert_eq((maths::file::load<int>(PATH) == i32Matrix({ { 1, 2, 3 }, { 4, 5, 6 } })));
+        assert_eq(throws<std::logic_error>([]() { maths::file::map<int>(PATH); }));
+
+        {
+            std::ofstream out(PATH, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(values), sizeof(values) - 1);
+        }
+        assert_eq(throws<std::runtime_error>([]() { maths::file::load<int>(PATH); }));
+
+        header.magic[0] = 'X';
+        {
+            std::ofstream out(PATH, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(values), sizeof(values));
+        }
+        assert_eq(throws<std::runtime_error>([]() { maths::file::map<int>(PATH); }));
+
+        std::remove(PATH);
+        results();
+    }
+}
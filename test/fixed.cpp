@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - fixed.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [7:50 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+
+constexpr f64Matrix4 translation(const double& x, const double& y, const double& z)
+{
+    return f64Matrix4(1, 0, 0, x,
+                      0, 1, 0, y,
+                      0, 0, 1, z,
+                      0, 0, 0, 1);
+}
+
+// Evaluated at compile time
+constexpr f64Matrix4 moved = translation(1, 2, 3) * translation(4, 5, 6);
+static_assert(moved(0, 3) == 5 && moved(1, 3) == 7 && moved(2, 3) == 9, "constexpr multiply");
+static_assert(moved.inverse() * moved == f64Matrix4(1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1.),
+              "constexpr inverse");
+static_assert(FixedMatrix<int, 2, 3>(1, 2, 3, 4, 5, 6).transpose()(2, 1) == 6, "constexpr transpose");
+static_assert(FixedMatrix<int, 3, 3>(8, 5, -2, 4, 7, 20, 7, 6, 1).determinant() == -174, "constexpr determinant");
+static_assert((translation(1, 2, 3) * f64Vector4(0., 0., 0., 1.))[2] == 3, "constexpr matrix-vector product");
+static_assert(f32Vector3(1, 2, 3).dot(f32Vector3(4, 5, 6)) == 32, "constexpr dot product");
+
+int main()
+{
+    {
+        title("Fixed-size matrices");
+
+        const FixedMatrix<float, 4, 4> f(1, 4, 2, 1,
+                                         6, 8, 4, 3,
+                                         3, 4, 8, 6,
+                                         1, 2, 4, 1);
+        assert_eq(f.determinant() == 180);
+        assert_eq((f.cofactor() == FixedMatrix<float, 4, 4>(-96,  72, -18,  24,
+                                                            48,  -6,  -6, -12,
+                                                           -12,  -6,  -6,  48,
+                                                            24, -18,  72, -96)));
+        assert_eq(f.adjoint() == f.cofactor().transpose());
+        assert_eq(f.trace() == 18);
+        assert_eq(f32Matrix2(1, 2, 3, 4).inverse() == f32Matrix2(-2, 1, 1.5, -.5));
+        assert_eq(f32Matrix3(1.f) + f32Matrix3(2.f) == 3.f * f32Matrix3(1.f));
+        assert_eq(sizeof(f32Matrix4) == 16 * sizeof(float));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Interoperability");
+
+        const f32Matrix dynamic({ { 1, 2 }, { 3, 4 } });
+        const f32Matrix2 fixed(dynamic);
+        assert_eq(fixed == f32Matrix2(1, 2, 3, 4));
+        assert_eq(static_cast<f32Matrix>(fixed) == dynamic);
+        assert_eq(static_cast<f32Vector>(f32Vector3(1, 2, 3)) == f32Vector({ 1, 2, 3 }));
+        assert_eq(f32Vector3(f32Vector({ 1, 2, 3 })) == f32Vector3(1, 2, 3));
+        assert_eq(f32Matrix(f32Matrix3(1.f) * f32Matrix3(2.f)) == f32Matrix(3, 3, 1.f) * f32Matrix(3, 3, 2.f));
+
+        results();
+    }
+}
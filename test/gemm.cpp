@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - gemm.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [9:48 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <chrono>
+
+template < class K >
+Matrix<K> naive(const Matrix<K>& a, const Matrix<K>& b)
+{
+    Matrix<K> result(a.height(), b.width());
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < b.width(); ++n)
+            for (size_t p = 0; p < a.width(); ++p)
+                result.at(m, n) += a.at(m, p) * b.at(p, n);
+    return result;
+}
+
+template < class K >
+bool check(const size_t& m, const size_t& n, const size_t& k)
+{
+    const Matrix<K> a = sequence<K>(m, k, 1);
+    const Matrix<K> b = sequence<K>(k, n, 2);
+    return a * b == naive(a, b);
+}
+
+template < class K >
+void report(const char* name, const size_t& size)
+{
+    const Matrix<K> a = sequence<K>(size, size, 1);
+    const Matrix<K> b = sequence<K>(size, size, 2);
+
+    const auto start = std::chrono::steady_clock::now();
+    const Matrix<K> c = a * b;
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "\033[2m" << name << " " << size << "x" << size << ": "
+              << maths::gemm::flops(size, size, size) / elapsed.count() * 1e-9
+              << " GFLOPS\033[0m" << std::endl;
+}
+
+int main()
+{
+    {
+        title("Blocked multiplication");
+
+        assert_eq(check<float>(1, 1, 1));
+        assert_eq(check<float>(6, 16, 3));
+        assert_eq(check<float>(7, 17, 5));
+        assert_eq(check<float>(150, 33, 300));
+        assert_eq(check<float>(31, 4100, 2));
+        assert_eq(check<double>(13, 9, 27));
+        assert_eq(check<double>(80, 70, 260));
+        assert_eq(check<int>(5, 5, 5));
+        assert_eq(check<long long>(67, 3, 129));
+        assert_eq((f32Matrix(3, 0) * f32Matrix(0, 2) == f32Matrix(3, 2)));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Threaded multiplication");
+
+        maths::ThreadPool::set_threads(4);
+        assert_eq(maths::ThreadPool::threads() == 4);
+        assert_eq(check<float>(200, 300, 70));
+        assert_eq(check<double>(97, 1031, 65));
+        assert_eq(check<int>(130, 7, 300));
+        maths::ThreadPool::set_threads(0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        report<float>("f32Matrix", 256);
+        report<double>("f64Matrix", 256);
+    }
+}
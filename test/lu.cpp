@@ -0,0 +1,238 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - lu.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [5:12 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <chrono>
+
+// Tridiagonal matrix of 2 with -1 around, whose determinant is n + 1
+f64Matrix laplacian(const size_t& size)
+{
+    f64Matrix result(size, size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        result.at(i, i) = 2;
+        if (i)
+            result.at(i, i - 1) = result.at(i - 1, i) = -1;
+    }
+    return result;
+}
+
+// Matrix of 1 to n^2 row by row, singular from n = 3
+template < class K >
+Matrix<K> counting(const size_t& size)
+{
+    Matrix<K> result(size, size);
+    for (size_t i = 0; i < size * size; ++i)
+        result.at(i / size, i % size) = static_cast<K>(i + 1);
+    return result;
+}
+
+// Rebuilds PA from the packed factors and compares it with A
+bool reconstructs(const f64Matrix& a)
+{
+    const LU<double> lu = a.lu();
+    const size_t n = lu.size();
+    f64Matrix lower(n, n), upper(n, n);
+    for (size_t m = 0; m < n; ++m)
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (i < m)
+                lower.at(m, i) = lu.factors().at(m, i);
+            else
+                upper.at(m, i) = lu.factors().at(m, i);
+        }
+    for (size_t i = 0; i < n; ++i)
+        lower.at(i, i) = 1;
+
+    f64Matrix permuted = a;
+    for (size_t i = 0; i < n; ++i)
+        permuted.swap_rows(i, lu.pivots()[i]);
+
+    const f64Matrix product = lower * upper;
+    for (size_t m = 0; m < n; ++m)
+        for (size_t i = 0; i < n; ++i)
+            if (std::abs(product.at(m, i) - permuted.at(m, i)) > 1e-9)
+                return false;
+    return true;
+}
+
+// Checks that A * inverse(A) is the identity
+bool inverts(const f64Matrix& a, const f64Matrix& inverse)
+{
+    const f64Matrix product = a * inverse;
+    for (size_t m = 0; m < product.height(); ++m)
+        for (size_t n = 0; n < product.width(); ++n)
+            if (std::abs(product.at(m, n) - (m == n ? 1 : 0)) > 1e-9)
+                return false;
+    return true;
+}
+
+bool throws_singular(const f64Matrix& a)
+{
+    try
+        { a.inverse(); }
+    catch (const std::runtime_error&)
+        { return true; }
+    return false;
+}
+
+// Checks that AX = B
+bool solves(const f64Matrix& a, const f64Matrix& x, const f64Matrix& b)
+{
+    const f64Matrix product = a * x;
+    for (size_t m = 0; m < product.height(); ++m)
+        for (size_t n = 0; n < product.width(); ++n)
+            if (std::abs(product.at(m, n) - b.at(m, n)) > 1e-9)
+                return false;
+    return true;
+}
+
+using PaddedMatrix = Matrix<double, maths::PaddedAllocator<double>>;
+
+PaddedMatrix padded(const f64Matrix& a)
+{
+    PaddedMatrix result(a.height(), a.width());
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            result.at(m, n) = a.at(m, n);
+    return result;
+}
+
+// Compares the elements of matrices of any allocators
+template < class A, class B >
+bool close(const Matrix<double, A>& a, const Matrix<double, B>& b)
+{
+    if (a.shape() != b.shape())
+        return false;
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            if (std::abs(a.at(m, n) - b.at(m, n)) > 1e-9 * (1 + std::abs(b.at(m, n))))
+                return false;
+    return true;
+}
+
+int main()
+{
+    {
+        title("LU factorization");
+
+        assert_eq(reconstructs(sequence<double>(5, 5, 0, 20)));
+        assert_eq(reconstructs(sequence<double>(70, 70, 0, 20)));
+        assert_eq(reconstructs(sequence<double>(150, 150, 0, 20)));
+        assert_eq(!sequence<double>(150, 150, 0, 20).lu().singular());
+        assert_eq(f64Matrix({ { 1, 2 }, { 2, 4 } }).lu().singular());
+        assert_eq(f64Matrix({ { 0, 1 }, { 1, 0 } }).lu().pivots()[0] == 1);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Determinant from LU");
+
+        assert_feq(laplacian(12).determinant(), 13.0);
+        assert_feq(laplacian(15).determinant(), 16.0);
+        assert_feq(laplacian(200).determinant(), 201.0);
+        assert_feq(f64Matrix({ { 0, 1 }, { 1, 0 } }).lu().determinant(), -1.0);
+        assert_eq(f64Matrix({ { 1, 2, 3, 4, 5 }, { 2, 4, 6, 8, 10 }, { 1, 0, 1, 0, 1 }, { 3, 1, 4, 1, 5 }, { 9, 2, 6, 5, 3 } }).determinant() == 0);
+
+        // Singular integral matrices leave only rounding noise in their pivots
+        bool singular = true;
+        for (size_t size = 3; size <= 12; ++size)
+            singular = singular && counting<float>(size).determinant() == 0 && counting<double>(size).determinant() == 0;
+        assert_eq(singular);
+        assert_eq(counting<double>(5).lu().determinant() == 0 && !counting<double>(5).lu().invertible());
+
+        // Badly scaled, but far from singular: no pivot is negligible before its row
+        assert_feq(f64Matrix({ { 1e20, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } }).determinant() / 1e20, 1.0);
+        assert_feq(f32Matrix({ { 1e-20f, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } }).determinant() / 1e-20f, 1.0);
+        assert_eq(f64Matrix({ { 1e-20, 0 }, { 0, 1 } }).lu().singular());
+        assert_feq(f64Matrix({ { 1e-20, 0 }, { 0, 1 } }).lu().determinant() * 1e20, 1.0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Inverse from LU");
+
+        assert_eq(inverts(sequence<double>(4, 4, 0, 20), sequence<double>(4, 4, 0, 20).inverse()));
+        assert_eq(inverts(sequence<double>(64, 64, 0, 20), sequence<double>(64, 64, 0, 20).inverse()));
+        assert_eq(inverts(sequence<double>(200, 200, 0, 20), sequence<double>(200, 200, 0, 20).inverse()));
+        assert_eq(inverts(laplacian(100), laplacian(100).lu().inverse()));
+        assert_eq(throws_singular(f64Matrix({ { 1, 2, 3, 4 }, { 5, 6, 7, 8 }, { 9, 10, 11, 12 }, { 13, 14, 15, 16 } })));
+        // Only pivots negligible before their own rows are refused
+        const f32Matrix tiny({ { 1e-20f, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } });
+        assert_feq(tiny.inverse().at(0, 0) / 1e20f, 1.0);
+        assert_feq(tiny.cofactor().at(1, 1) / 1e-20f, 1.0);
+        assert_eq(f64Matrix({ { 1e-20, 0 }, { 0, 1 } }).lu().invertible());
+        assert_eq(!f64Matrix({ { 1, 2 }, { 2, 4 } }).lu().invertible());
+        assert_eq(inverts(sequence<double>(64, 64, 0, 20), f64Matrix(sequence<double>(64, 64, 0, 20) * 1e-30).inverse() * 1e-30));
+        assert_feq(laplacian(10).adjoint().at(0, 0), 10.0);
+        assert_feq(laplacian(10).cofactor().at(9, 0), 1.0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Solving systems");
+
+        const f64Matrix a = sequence<double>(150, 150, 0, 20);
+        const LU<double> lu = a.lu();
+        f64Matrix b(150, 300);
+        for (size_t m = 0; m < 150; ++m)
+            for (size_t n = 0; n < 300; ++n)
+                b.at(m, n) = static_cast<double>((m * 5 + n) % 17) - 8;
+
+        assert_eq(solves(a, lu.solve(b), b));
+        assert_eq(solves(a, solve(a, f64Matrix(150, 1, 1.)), f64Matrix(150, 1, 1.)));
+        assert_eq(solves(sequence<double>(3, 3, 0, 20), solve(sequence<double>(3, 3, 0, 20), f64Matrix(3, 2, 2.)), f64Matrix(3, 2, 2.)));
+        assert_eq(solve(f64Matrix({ { 2, 1 }, { 1, 3 } }), f64Vector({ 3, 5 })) == f64Vector({ .8, 1.4 }));
+        assert_eq(lu.solve(f64Matrix(150, 0)).shape() == f64Matrix(150, 0).shape());
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Padded rows");
+
+        // Factors keep the padding of their allocator, rows being stride() apart
+        const f64Matrix a = sequence<double>(70, 70, 0, 20), b = sequence<double>(70, 70, 0, 20).transpose();
+        const LU<double, maths::PaddedAllocator<double>> lu(padded(a));
+        assert_eq(lu.factors().stride() == 72 && !lu.singular());
+        assert_feq(lu.determinant() / a.determinant(), 1.0);
+        assert_feq((LU<double, maths::PaddedAllocator<double>>(padded(sequence<double>(5, 5, 0, 20))).determinant()),
+                   sequence<double>(5, 5, 0, 20).determinant());
+        assert_eq(close(lu.solve(padded(b)), a.lu().solve(b)));
+        assert_eq(close(lu.inverse(), a.inverse()));
+        assert_eq(close(LU<double, maths::PaddedAllocator<double>>(padded(a)).inverse(), a.inverse()));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        const f64Matrix a = sequence<double>(512, 512, 0, 20);
+        const auto start = std::chrono::steady_clock::now();
+        a.determinant();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "\033[2mf64Matrix 512x512 determinant: " << elapsed.count() * 1e3 << " ms\033[0m" << std::endl;
+
+        const auto restart = std::chrono::steady_clock::now();
+        a.inverse();
+        const std::chrono::duration<double> inversion = std::chrono::steady_clock::now() - restart;
+        std::cout << "\033[2mf64Matrix 512x512 inverse: " << inversion.count() * 1e3 << " ms\033[0m" << std::endl;
+
+        const f64Matrix b(512, 256, 1.);
+        const auto resolve = std::chrono::steady_clock::now();
+        solve(a, b);
+        const std::chrono::duration<double> solving = std::chrono::steady_clock::now() - resolve;
+        std::cout << "\033[2mf64Matrix 512x512 solve (256 right-hand sides): "
+                  << solving.count() * 1e3 << " ms\033[0m" << std::endl;
+    }
+}
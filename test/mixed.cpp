@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - mixed.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [7:55 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <mixed.hpp>
+#include <cmath>
+
+template < class R, class K >
+Matrix<R> widen(const Matrix<K>& matrix)
+{
+    Matrix<R> result(matrix.height(), matrix.width());
+    for (size_t m = 0; m < matrix.height(); ++m)
+        for (size_t n = 0; n < matrix.width(); ++n)
+            result.at(m, n) = static_cast<R>(matrix.at(m, n));
+    return result;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Wide accumulation");
+
+        // 1 + 2^-24 is lost at every float step, kept by doubles
+        const size_t size = 1 << 12;
+        f32Vector u(size, 1.f), v(size, 1.f);
+        u[0] = 16777216.f;
+        assert_eq(u.dot<double>(v) == 16777216. + static_cast<double>(size - 1));
+        assert_eq(u.view().dot<double>(v) == 16777216. + static_cast<double>(size - 1));
+
+        // Products in doubles read in floats match products of the widened operands
+        const f32Matrix a = sequence<float>(203, 317, 1);
+        const f32Matrix b = sequence<float>(317, 45, 2);
+        assert_eq(maths::mixed::multiply<double>(a, b) == widen<double>(a) * widen<double>(b));
+        const f64Matrix blocks = f64Matrix(widen<double>(a).block(3, 5, 100, 80))
+                               * f64Matrix(widen<double>(b).block(5, 2, 80, 30));
+        assert_eq((maths::mixed::multiply<double, float>(a.block(3, 5, 100, 80), b.block(5, 2, 80, 30)) == blocks));
+
+        const f32Vector x = f32Vector(b.column(7));
+        const f64Vector y = maths::mixed::multiply<double>(a.block(0, 0, 203, 317), x.view());
+        const f64Matrix expected = widen<double>(a) * widen<double>(x.to_matrix());
+        bool same = y.size() == 203;
+        for (size_t m = 0; same && m < y.size(); ++m)
+            same = std::abs(y[m] - expected.at(m, 0)) <= 1e-12 * (1 + std::abs(expected.at(m, 0)));
+        assert_eq(same);
+        assert_eq(throws<std::logic_error>([&]() { maths::mixed::multiply<double>(a, a); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Iterative refinement");
+
+        const size_t size = 300;
+        const f32Matrix a = sequence<float>(size, size, 0, static_cast<float>(size));
+        const f64Matrix wide = widen<double>(a);
+        f64Vector b(size);
+        for (size_t m = 0; m < size; ++m)
+            b[m] = std::sin(static_cast<double>(m));
+
+        // Single factorization in floats, yet double accuracy
+        const f64Vector x = maths::mixed::solve(a, b);
+        const f64Vector reference = solve(wide, b);
+        f32Vector narrow(size);
+        for (size_t m = 0; m < size; ++m)
+            narrow[m] = static_cast<float>(b[m]);
+        const f32Vector low = solve(a, narrow);
+        double error = 0, error_low = 0;
+        for (size_t m = 0; m < size; ++m)
+        {
+            error = std::max(error, std::abs(x[m] - reference[m]));
+            error_low = std::max(error_low, std::abs(low[m] - reference[m]));
+        }
+        assert_eq(error < 1e-13);
+        assert_eq(error_low > 1e-9);
+
+        // Too ill-conditioned for floats: falls back to doubles
+        f32Matrix hilbert(8, 8);
+        for (size_t m = 0; m < 8; ++m)
+            for (size_t n = 0; n < 8; ++n)
+                hilbert.at(m, n) = 1.f / static_cast<float>(m + n + 1);
+        const f64Vector ones(8, 1.);
+        const f64Vector h = maths::mixed::solve(hilbert, ones);
+        const f64Vector r = maths::mixed::residual<double, float>(hilbert.view(), h.view(), ones.view());
+        bool small = true;
+        for (size_t m = 0; m < 8; ++m)
+            small = small && std::abs(r[m]) < 1e-6;
+        assert_eq(small);
+
+        assert_eq(throws<std::logic_error>([&]() { maths::mixed::solve(f32Matrix(3, 4), f64Vector(3)); }));
+        assert_eq(throws<std::logic_error>([&]() { maths::mixed::solve(a, f64Vector(3)); }));
+        assert_eq(throws<std::runtime_error>([&]() { maths::mixed::solve(f32Matrix(3, 3), f64Vector(3)); }));
+
+        results();
+    }
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - modular.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [12:40 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <Modular.hpp>
+
+constexpr uint32_t PRIME = 998244353;
+using F = Modular<PRIME>;
+using f7Matrix = Matrix<Modular<7>>;
+
+/**
+ * Checks a product against sums of integer products, reduced at every step
+ */
+bool check_product(const size_t& height, const size_t& width, const size_t& depth)
+{
+    const Matrix<F> a = sequence<F>(height, depth, 1), b = sequence<F>(depth, width, 2);
+    const Matrix<F> c = a * b;
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+        {
+            uint64_t sum = 0;
+            for (size_t k = 0; k < depth; ++k)
+                sum = (sum + static_cast<uint64_t>(a.at(m, k).value()) * b.at(k, n).value()) % PRIME;
+            if (c.at(m, n).value() != sum)
+                return false;
+        }
+    return true;
+}
+
+/**
+ * Checks the reduced row echelon form: leading ones, alone in their columns,
+ * and rows spanning the same space as the original ones
+ */
+bool check_echelon(const Matrix<F>& a)
+{
+    const Matrix<F> r = a.row_echelon();
+    const size_t rank = a.rank();
+    size_t column = 0;
+    for (size_t m = 0; m < a.height(); ++m)
+    {
+        while (column < a.width() && r.at(m, column) == F())
+            ++column;
+        if ((m < rank) != (column < a.width()))
+            return false;
+        if (m >= rank)
+            continue;
+        if (r.at(m, column) != F(1))
+            return false;
+        for (size_t i = 0; i < a.height(); ++i)
+            if (i != m && r.at(i, column) != F())
+                return false;
+    }
+
+    Matrix<F> stacked(2 * a.height(), a.width());
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+        {
+            stacked.at(m, n) = a.at(m, n);
+            stacked.at(a.height() + m, n) = r.at(m, n);
+        }
+    return stacked.rank() == rank;
+}
+
+template < class E, class Fn >
+bool throws(const Fn& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Arithmetic");
+
+        const F a(123456789), b(-5);
+        assert_eq(a.value() == 123456789 && b.value() == PRIME - 5);
+        assert_eq((a * b).value() == (static_cast<uint64_t>(123456789) * (PRIME - 5)) % PRIME);
+        assert_eq((a + b).value() == 123456784 && (b - a).value() == PRIME - 123456794);
+        assert_eq((-F(0)).value() == 0 && (-a + a) == F());
+        assert_eq(a / a == F(1) && (a * a.inverse()).value() == 1);
+        assert_eq(F(3).pow(PRIME - 1) == F(1));
+        assert_eq(F(2).pow(10).value() == 1024);
+        assert_eq(F(static_cast<unsigned long long>(-1)).value() == static_cast<unsigned long long>(-1) % PRIME);
+        assert_eq(Modular<7>(-1).value() == 6 && Modular<3>(5).value() == 2);
+        assert_eq(throws<std::domain_error>([]() { F(PRIME).inverse(); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Products");
+
+        // Around tiles, and deep enough to fold the lazy sums many times
+        assert_eq(check_product(1, 1, 1));
+        assert_eq(check_product(7, 13, 5));
+        assert_eq(check_product(70, 45, 600));
+        assert_eq(check_product(3, 2, 1000));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Elimination");
+
+        // Independent over the rationals, yet not modulo 7
+        const f7Matrix small({ { 1, 1 }, { 1, 8 } });
+        assert_eq(small.rank() == 1 && small.determinant() == Modular<7>());
+        assert_eq(i32Matrix({ { 1, 1 }, { 1, 8 } }).rank() == 2);
+
+        // Determinants match the integer ones, swaps included
+        const i64Matrix integers({ { 0, 2, 1, 0, 5 }, { 1, 1, 0, 0, -3 }, { 0, 0, 3, 1, 2 },
+                                   { 1, 0, 0, 2, 0 }, { 4, -2, 1, 1, 1 } });
+        Matrix<F> field(5, 5);
+        for (size_t m = 0; m < 5; ++m)
+            for (size_t n = 0; n < 5; ++n)
+                field.at(m, n) = F(integers.at(m, n));
+        assert_eq(field.determinant() == F(integers.determinant()));
+
+        // Over several panels: ranks of products, and determinants of products
+        const Matrix<F> a = sequence<F>(150, 90, 3), b = sequence<F>(90, 200, 4);
+        assert_eq(a.rank() == 90 && (a * b).rank() == 90);
+        const Matrix<F> c = sequence<F>(130, 130, 5), d = sequence<F>(130, 130, 6);
+        assert_eq((c * d).determinant() == c.determinant() * d.determinant());
+        assert_eq(c.determinant() != F());
+
+        assert_eq(check_echelon(a * b) && check_echelon(sequence<F>(40, 170, 7)) && check_echelon(sequence<F>(70, 3, 8)));
+        assert_eq(check_echelon(Matrix<F>(4, 6)));
+
+        // Columns without pivots within the panels
+        Matrix<F> repeated = a * b;
+        for (size_t n = 2; n < repeated.width(); n += 3)
+            for (size_t m = 0; m < repeated.height(); ++m)
+                repeated.at(m, n) = repeated.at(m, n - 1) + repeated.at(m, n - 2);
+        assert_eq(repeated.rank() == 90 && check_echelon(repeated));
+
+        results();
+    }
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - points.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [6:55 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <points.hpp>
+#include <cmath>
+#include <vector>
+
+using maths::points::SoA;
+using maths::points::transform;
+
+template < class K >
+FixedMatrix<K, 4, 4> pose(const K& angle, const K& x, const K& y, const K& z)
+{
+    const K c = std::cos(angle), s = std::sin(angle);
+    return FixedMatrix<K, 4, 4>(c, -s, K(0), x,
+                                s,  c, K(0), y,
+                                K(0), K(0), K(1), z,
+                                K(0), K(0), K(0), K(1));
+}
+
+template < class K >
+bool close(const K& a, const K& b)
+    { return std::abs(a - b) <= K(1e-4) * (1 + std::abs(b)); }
+
+/**
+ * Checks transformed coordinate arrays against the fixed-size matrix-vector product
+ */
+template < class K, class F >
+bool check(const F& transforms, const std::vector<K>* in, const std::vector<K>* out, const bool& homogeneous)
+{
+    for (size_t i = 0; i < in[0].size(); ++i)
+    {
+        const FixedVector<K, 4> p(in[0][i], in[1][i], in[2][i], homogeneous ? in[3][i] : K(1));
+        const FixedVector<K, 4> expected = transforms(i) * p;
+        for (size_t d = 0; d < (homogeneous ? 4u : 3u); ++d)
+            if (!close(out[d][i], expected[d]))
+                return false;
+    }
+    return true;
+}
+
+template < class K >
+bool run(const size_t& count)
+{
+    bool valid = true;
+    const FixedMatrix<K, 4, 4> m = pose(K(.5), K(1), K(-2), K(3));
+    const auto same = [&](const size_t&) { return m; };
+    const Matrix<K> values = sequence<K>(4, count);
+    std::vector<K> in[4];
+    for (size_t d = 0; d < 4; ++d)
+        in[d].assign(values.data() + d * values.stride(), values.data() + d * values.stride() + count);
+    std::vector<K> out[4] = { std::vector<K>(count), std::vector<K>(count), std::vector<K>(count),
+                              std::vector<K>(count, K(-7)) };
+    const SoA<const K> source = { in[0].data(), in[1].data(), in[2].data(), in[3].data() };
+    const SoA<K> target = { out[0].data(), out[1].data(), out[2].data(), out[3].data() };
+
+    // Structure of arrays, homogeneous then with an implicit w
+    transform(m, source, target, count);
+    valid &= check(same, in, out, true);
+    transform(m, SoA<const K>{ in[0].data(), in[1].data(), in[2].data(), nullptr },
+              SoA<K>{ out[0].data(), out[1].data(), out[2].data(), nullptr }, count);
+    valid &= check(same, in, out, false);
+
+    // Interleaved, in place, 3 and 4 coordinates
+    for (size_t dimensions = 3; dimensions <= 4; ++dimensions)
+    {
+        std::vector<K> points(count * dimensions);
+        for (size_t i = 0; i < count; ++i)
+            for (size_t d = 0; d < dimensions; ++d)
+                points[i * dimensions + d] = in[d][i];
+        transform(m, points.data(), points.data(), count, dimensions);
+        for (size_t i = 0; i < count; ++i)
+            for (size_t d = 0; d < dimensions; ++d)
+                out[d][i] = points[i * dimensions + d];
+        valid &= check(same, in, out, dimensions == 4);
+    }
+
+    // One transform per point
+    std::vector<FixedMatrix<K, 4, 4>> transforms;
+    for (size_t i = 0; i < count; ++i)
+        transforms.push_back(pose(static_cast<K>(i % 13), K(i % 5), K(1), K(-1)));
+    const auto each = [&](const size_t& i) { return transforms[i]; };
+    transform(transforms.data(), source, target, count);
+    valid &= check(each, in, out, true);
+
+    std::vector<K> points(count * 3);
+    for (size_t i = 0; i < count; ++i)
+        for (size_t d = 0; d < 3; ++d)
+            points[i * 3 + d] = in[d][i];
+    std::vector<K> moved(count * 3);
+    transform(transforms.data(), points.data(), moved.data(), count, 3);
+    for (size_t i = 0; i < count; ++i)
+        for (size_t d = 0; d < 3; ++d)
+            out[d][i] = moved[i * 3 + d];
+    valid &= check(each, in, out, false);
+    return valid;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Point transforms");
+
+        // Below a vector width, around blocks, and over several parallel chunks
+        for (const size_t count : { 0, 1, 7, 257, 1000, 100003 })
+            assert_eq(run<float>(count) && run<double>(count));
+        assert_eq(run<int>(65));
+
+        // Dense matrices are accepted when 4x4
+        const f64Matrix4 fixed = pose(1., 2., 3., 4.);
+        f64Matrix m(4, 4);
+        for (size_t r = 0; r < 4; ++r)
+            for (size_t c = 0; c < 4; ++c)
+                m.at(r, c) = fixed(r, c);
+        double point[4] = { 1, 2, 3, 1 };
+        transform(m, point, point, 1);
+        const f64Vector4 expected = fixed * f64Vector4(1., 2., 3., 1.);
+        assert_eq(close(point[0], expected[0]) && close(point[1], expected[1]) && close(point[2], expected[2]));
+        assert_eq(point[3] == 1);
+
+        assert_eq(throws<std::logic_error>([&]() { transform(f64Matrix(3, 3), point, point, 1); }));
+        assert_eq(throws<std::logic_error>([&]() { transform(fixed, point, point, 1, 2); }));
+
+        results();
+    }
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - qr.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [10:10 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <cmath>
+
+/**
+ * Builds a matrix of the given rank, as the product of two random-looking
+ * factors, plus rounding-sized noise
+ */
+f64Matrix deficient(const size_t& height, const size_t& width, const size_t& rank)
+{
+    f64Matrix result = sequence<double>(height, rank, 1) * sequence<double>(rank, width, 2);
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+            result.at(m, n) += 1e-15 * std::cos(static_cast<double>(m + 3 * n));
+    return result;
+}
+
+double largest_gap(const f64Matrix& a, const f64Matrix& b)
+{
+    double gap = 0;
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            gap = std::max(gap, std::abs(a.at(m, n) - b.at(m, n)));
+    return gap;
+}
+
+/**
+ * Checks Q'Q = I, and QR against the permuted columns of A
+ */
+bool check(const f64Matrix& a)
+{
+    const QR<double> qr = a.qr();
+    const f64Matrix q = qr.q();
+    const f64Matrix r = qr.r();
+    f64Matrix permuted(a.height(), a.width());
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            permuted.at(m, n) = a.at(m, qr.permutation()[n]);
+    f64Matrix identity(q.width(), q.width());
+    for (size_t i = 0; i < q.width(); ++i)
+        identity.at(i, i) = 1;
+
+    bool decreasing = true;
+    for (size_t i = 1; i < r.height(); ++i)
+        decreasing = decreasing && std::abs(r.at(i, i)) <= std::abs(r.at(i - 1, i - 1)) * (1 + 1e-12);
+    return decreasing
+        && largest_gap(q.transpose() * q, identity) < 1e-12
+        && largest_gap(q * r, permuted) < 1e-12;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Factorization");
+
+        // Below, at, and over a panel width, tall and wide
+        for (const size_t size : { 1, 7, 32, 45, 100 })
+            assert_eq(check(sequence<double>(size + 13, size)) && check(sequence<double>(size, size + 13)));
+        assert_eq(check(deficient(150, 80, 20)));
+        assert_eq(check(f64Matrix(5, 3)));
+
+        // Pivoting picks the largest column first
+        const f64Matrix a({ { 1, 0, 5 }, { 0, 1, 0 }, { 0, 0, 0 } });
+        assert_eq(a.qr().permutation()[0] == 2);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Rank");
+
+        // Rounding noise does not count towards the rank
+        assert_eq(deficient(300, 120, 37).rank() == 37);
+        assert_eq(deficient(40, 90, 12).rank() == 12);
+        const f64Matrix narrow({ { 1, 2, 3 }, { 2, 4, 6.0000005 }, { 1, 0, 1 } });
+        assert_eq(narrow.rank() == 3);
+        assert_eq(narrow.rank(1e-6) == 2);
+
+        // Nor does the noise of float values, though factorized in double
+        f32Matrix noisy({ { 0.3f, -1.7f, 2.9f }, { 1.1f, 0.6f, -0.35f }, { 0, 0, 0 } });
+        for (size_t n = 0; n < 3; ++n)
+            noisy.at(2, n) = 3 * noisy.at(0, n) + noisy.at(1, n) / 7;
+        assert_eq(noisy.rank() == 2 && noisy.rank() == QR<float>(noisy).rank());
+
+        const f64Matrix full = sequence<double>(200, 60);
+        assert_eq(full.rank() == 60 && full.qr().rank() == 60);
+        assert_eq(f64Matrix(4, 4).rank() == 0 && f64Matrix(0, 3).rank() == 0);
+        assert_eq(i32Matrix({ { 1, 2 }, { 2, 4 } }).rank() == 1);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Least squares");
+
+        // Matches the normal equations on a well-conditioned tall system
+        const f64Matrix a = sequence<double>(500, 40);
+        f64Vector b(500);
+        for (size_t m = 0; m < 500; ++m)
+            b[m] = std::cos(static_cast<double>(m));
+        const f64Vector x = lstsq(a, b);
+        const f64Matrix at = a.transpose();
+        const f64Vector normal = solve(at * a, at * b);
+        double gap = 0;
+        for (size_t n = 0; n < 40; ++n)
+            gap = std::max(gap, std::abs(x[n] - normal[n]));
+        assert_eq(x.size() == 40 && gap < 1e-10);
+
+        // Several right-hand sides at once, consistent systems solved exactly
+        const f64Matrix expected = sequence<double>(40, 3);
+        const f64Matrix solved = lstsq(a, a * expected);
+        assert_eq(largest_gap(solved, expected) < 1e-12);
+
+        // Rank-deficient: the residual is still minimal
+        const f64Matrix d = deficient(120, 30, 10);
+        const QR<double> qr = d.qr();
+        const f64Matrix target = d * sequence<double>(30, 3);
+        const f64Matrix y = qr.solve(target);
+        assert_eq(qr.rank() == 10 && largest_gap(d * y, target) < 1e-10);
+
+        assert_eq(throws<std::logic_error>([&]() { lstsq(a, f64Vector(40)); }));
+        assert_eq(throws<std::logic_error>([&]() { qr.solve(f64Matrix(30, 2)); }));
+
+        results();
+    }
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - simd.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [3:25 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <simd.hpp>
+#include <vector>
+
+using maths::simd::isa;
+using maths::simd::kernels;
+
+// Elements past the end of every buffer, which kernels must leave untouched
+constexpr size_t GUARD = 4;
+
+/**
+ * Builds `count` pseudo-random values in [-1000, 1000], in eighths for
+ * floating types so that every kernel stays exact
+ */
+template < class T >
+std::vector<T> values(const size_t& count, size_t seed)
+{
+    std::vector<T> result(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const long long value = static_cast<long long>((seed >> 33) % 2001) - 1000;
+        result[i] = std::is_floating_point<T>::value ? static_cast<T>(value / 8.) : static_cast<T>(value);
+    }
+    return result;
+}
+
+/**
+ * Runs every kernel of a table over all lengths up to twice the widest
+ * lanes and one, from aligned and unaligned starts, against plain loops
+ */
+template < class T >
+bool sweep(const kernels<T>& table, const T& factor)
+{
+    const size_t lanes = 64 / sizeof(T);
+    for (size_t n = 0; n <= 2 * lanes + 1; ++n)
+        for (size_t offset = 0; offset < 2; ++offset)
+        {
+            const size_t size = offset + n + GUARD;
+            const std::vector<T> a = values<T>(size, n * 2 + offset), b = values<T>(size, n * 2 + offset + 100);
+            std::vector<T> sum = a, difference = a, scaled = a, absolute = a;
+            table.add(sum.data() + offset, b.data() + offset, n);
+            table.sub(difference.data() + offset, b.data() + offset, n);
+            table.scale(scaled.data() + offset, factor, n);
+            table.abs(absolute.data() + offset, n);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                const bool inside = i >= offset && i < offset + n;
+                if (sum[i] != (inside ? T(a[i] + b[i]) : a[i]) || difference[i] != (inside ? T(a[i] - b[i]) : a[i])
+                    || scaled[i] != (inside ? T(a[i] * factor) : a[i])
+                    || absolute[i] != (inside && a[i] < T() ? T(-a[i]) : a[i]))
+                    return false;
+            }
+
+            // Equal, then differing on each element in turn, tails included
+            if (!table.equal(a.data() + offset, a.data() + offset, n))
+                return false;
+            std::vector<T> other = a;
+            for (size_t i = offset; i < offset + n; ++i)
+            {
+                other[i] += 1;
+                if (table.equal(a.data() + offset, other.data() + offset, n))
+                    return false;
+                other[i] = a[i];
+            }
+            other[offset + n] += 1;
+            if (!table.equal(a.data() + offset, other.data() + offset, n))
+                return false;
+        }
+    return true;
+}
+
+/**
+ * Sweeps the four lane types through the given tables
+ */
+template < template < class > class F >
+bool sweep_all()
+{
+    return sweep(F<float>::get(), -1.5f) && sweep(F<double>::get(), 2.25)
+        && sweep(F<int>::get(), -3) && sweep(F<long long>::get(), 3000000007LL);
+}
+
+template < class T >
+struct dispatched { static const kernels<T>& get() { return maths::simd::table<T>(); } };
+
+/**
+ * Builds the table of a given instruction set, whatever the one in use
+ */
+template < isa I >
+struct target
+{
+    template < class T >
+    struct of { static kernels<T> get() { return kernels<T>(maths::simd::isa_tag<I>()); } };
+};
+
+int main()
+{
+    {
+        title("Dispatched kernels");
+
+        assert_eq(sweep_all<dispatched>());
+        assert_eq(sweep_all<target<isa::scalar>::of>());
+
+        // Through the public entry points, and the plain loops for other types
+        std::vector<long long> big = values<long long>(37, 1);
+        const std::vector<long long> original = big;
+        maths::simd::scale(big.data(), 3000000007LL, big.size());
+        bool scaled = true;
+        for (size_t i = 0; i < big.size(); ++i)
+            scaled = scaled && big[i] == original[i] * 3000000007LL;
+        assert_eq(scaled);
+        std::vector<short> narrow(19, -7);
+        maths::simd::abs(narrow.data(), narrow.size());
+        assert_eq(narrow[18] == 7 && maths::simd::equal(narrow.data(), std::vector<short>(19, 7).data(), 19));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Instruction sets");
+
+#ifdef MATRIX_X86
+        const isa level = maths::simd::level();
+        assert_eq(level < isa::sse2 || sweep_all<target<isa::sse2>::of>());
+        assert_eq(level < isa::avx2 || sweep_all<target<isa::avx2>::of>());
+        assert_eq(level < isa::avx512 || sweep_all<target<isa::avx512>::of>());
+
+        // 64-bit integers only multiply in vectors from AVX-512 on
+        const bool fallback = maths::simd::table<long long>().scale == maths::simd::scale_scalar<long long>;
+        assert_eq(fallback == (level < isa::avx512));
+#else
+        assert_eq(maths::simd::level() == isa::scalar);
+#endif
+
+        results();
+    }
+}
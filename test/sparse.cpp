@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - sparse.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [3:20 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <SparseMatrix.hpp>
+#include <cmath>
+
+template < class K >
+bool close(const Matrix<K>& a, const Matrix<K>& b)
+{
+    if (a.shape() != b.shape())
+        return false;
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            if (std::abs(a.at(m, n) - b.at(m, n)) > 1e-9 * (1 + std::abs(b.at(m, n))))
+                return false;
+    return true;
+}
+
+/**
+ * Builds a pseudo-random matrix with about one value out of `spread`
+ */
+f64Matrix scattered(const size_t& height, const size_t& width, const size_t& spread)
+{
+    f64Matrix result(height, width);
+    size_t seed = 12345;
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (!((seed >> 33) % spread))
+                result.at(m, n) = static_cast<double>((seed >> 40) % 19) - 9.;
+        }
+    return result;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Construction");
+
+        SparseBuilder<double> builder(3, 4);
+        builder.add(2, 1, 5);
+        builder.add(0, 3, 1);
+        builder.add(0, 0, 2);
+        builder.add(2, 1, -1);
+        builder.add(1, 2, 7);
+        const f64Matrix dense({ { 2, 0, 0, 1 }, { 0, 0, 7, 0 }, { 0, 4, 0, 0 } });
+
+        const CSRMatrix<double> csr(builder);
+        const CSCMatrix<double> csc(builder);
+        assert_eq(csr.nonzeros() == 4);
+        assert_eq(csr.at(2, 1) == 4 && csr.at(1, 1) == 0 && csc.at(0, 3) == 1);
+        assert_eq(csr.to_matrix() == dense);
+        assert_eq(csc.to_matrix() == dense);
+        assert_eq((csr.storage().offsets == std::vector<size_t>({ 0, 2, 3, 4 })));
+        assert_eq((csr.storage().indices == std::vector<size_t>({ 0, 3, 2, 1 })));
+        assert_eq((csc.storage().offsets == std::vector<size_t>({ 0, 1, 2, 3, 4 })));
+
+        assert_eq(CSRMatrix<double>(dense) == csr);
+        assert_eq(CSCMatrix<double>(dense) == csc);
+        assert_eq(CSCMatrix<double>(csr) == csc);
+        assert_eq(CSRMatrix<double>(csc) == csr);
+        assert_eq(csr.transpose().to_matrix() == dense.transpose());
+        assert_eq((csr * 2.).to_matrix() == dense * 2.);
+
+        assert_eq(throws<std::out_of_range>([&builder]() { builder.add(3, 0, 1); }));
+        assert_eq(throws<std::out_of_range>([&csr]() { csr.at(0, 4); }));
+        assert_eq(CSRMatrix<double>(SparseBuilder<double>(0, 5)).nonzeros() == 0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Products");
+
+        const f64Matrix a = scattered(60, 45, 7);
+        const f64Matrix b = scattered(45, 30, 5);
+        const f64Vector v = f64Vector(scattered(45, 1, 1));
+        const CSRMatrix<double> a_csr(a);
+        const CSCMatrix<double> a_csc(a);
+        const CSRMatrix<double> b_csr(b);
+        const CSCMatrix<double> b_csc(b);
+
+        assert_eq(close((a_csr * v).to_matrix(), (a * v).to_matrix()));
+        assert_eq(close((a_csc * v).to_matrix(), (a * v).to_matrix()));
+        assert_eq(close((a_csr * b.column(3)).to_matrix(), (a * f64Vector(b.column(3))).to_matrix()));
+        assert_eq(close(a_csr * b, a * b));
+        assert_eq(close(a_csc * b, a * b));
+        assert_eq(close(a_csr * b.block(0, 10, 45, 20), a * f64Matrix(b.block(0, 10, 45, 20))));
+        assert_eq(close((a_csr * b_csr).to_matrix(), a * b));
+        assert_eq(close((a_csc * b_csc).to_matrix(), a * b));
+        assert_eq(close((a_csr * b_csc).to_matrix(), a * b));
+        assert_eq(close((a_csc * b_csr).to_matrix(), a * b));
+
+        assert_eq(throws<std::logic_error>([&]() { a_csr * a; }));
+        assert_eq(throws<std::logic_error>([&]() { b_csc * v; }));
+        assert_eq(throws<std::logic_error>([&]() { a_csr * a_csc; }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Large systems");
+
+        // 1M x 1M tridiagonal system, far out of reach of dense storage
+        const size_t size = 1000000;
+        SparseBuilder<double> builder(size, size);
+        builder.reserve(3 * size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            builder.add(i, i, 4);
+            if (i)
+                builder.add(i, i - 1, -1);
+            if (i + 1 < size)
+                builder.add(i, i + 1, -2);
+        }
+        const CSRMatrix<double> a(builder);
+        assert_eq(a.nonzeros() == 3 * size - 2);
+
+        f64Vector x(size);
+        for (size_t i = 0; i < size; ++i)
+            x[i] = static_cast<double>(i % 7);
+        const f64Vector y = a * x;
+        bool exact = true;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const double expected = 4 * x[i] - (i ? x[i - 1] : 0) - 2 * (i + 1 < size ? x[i + 1] : 0);
+            exact = exact && y[i] == expected;
+        }
+        assert_eq(exact);
+        assert_eq((CSCMatrix<double>(a) * x == y));
+        assert_eq((a * a).at(size / 2, size / 2) == 16 + 2 + 2);
+
+        results();
+    }
+}
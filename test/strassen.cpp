@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - strassen.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [2:55 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <Modular.hpp>
+#include <cmath>
+
+/**
+ * Multiplies with Strassen-Winograd at the given crossover,
+ * and classically as a reference
+ */
+template < class K >
+std::pair<Matrix<K>, Matrix<K>> products(const Matrix<K>& a, const Matrix<K>& b, const size_t& crossover)
+{
+    maths::strassen::set_crossover(crossover);
+    Matrix<K> fast = a * b;
+    maths::strassen::set_crossover(0);
+    return { fast, a * b };
+}
+
+/**
+ * Checks a product against the classical one, within the error bound
+ * of Strassen-Winograd for operands of values in [-1, 1)
+ */
+template < class K >
+bool check(const size_t& height, const size_t& width, const size_t& depth, const size_t& crossover)
+{
+    maths::strassen::set_crossover(crossover);
+    const double levels = static_cast<double>(maths::strassen::levels(height, width, depth));
+    const std::pair<Matrix<K>, Matrix<K>> result =
+        products(sequence<K>(height, depth, 1) * K(.1), sequence<K>(depth, width, 2) * K(.1), crossover);
+
+    // Inner dimension, padded to a multiple of 2^levels
+    const double n0 = std::ceil(static_cast<double>(depth) / std::pow(2., levels));
+    const double n = n0 * std::pow(2., levels);
+    const double bound = (std::pow(n / n0, std::log2(18.)) * (n0 * n0 + 6 * n0) - 6 * n)
+                       * std::numeric_limits<K>::epsilon();
+    double error = 0;
+    for (size_t m = 0; m < height; ++m)
+        for (size_t j = 0; j < width; ++j)
+            error = std::max(error, static_cast<double>(std::abs(result.first.at(m, j) - result.second.at(m, j))));
+    return result.first.shape() == result.second.shape() && error <= bound;
+}
+
+int main()
+{
+    {
+        title("Settings");
+
+        assert_eq(maths::strassen::crossover() == 0);
+        assert_eq(!maths::strassen::applies<double>(4096, 4096, 4096));
+        maths::strassen::set_crossover(64);
+        assert_eq(maths::strassen::levels(64, 64, 64) == 1 && maths::strassen::levels(300, 129, 1000) == 2);
+        assert_eq(maths::strassen::levels(63, 1000, 1000) == 0);
+        assert_eq(maths::strassen::applies<float>(128, 128, 128) && !maths::strassen::applies<int>(128, 128, 128));
+        maths::strassen::set_crossover(0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Products");
+
+        // Even sizes, then padded ones over several levels
+        assert_eq(check<double>(128, 128, 128, 32));
+        assert_eq(check<double>(97, 75, 131, 16));
+        assert_eq(check<float>(200, 200, 200, 24));
+        assert_eq(check<double>(1, 1, 1, 1));
+
+        // Products too small for the crossover are left classical, bit for bit
+        const std::pair<f64Matrix, f64Matrix> small =
+            products(sequence<double>(40, 50, 3) * .1, sequence<double>(50, 60, 4) * .1, 64);
+        assert_eq(small.first == small.second);
+
+        // Exact fields lose nothing
+        using F = Modular<998244353>;
+        Matrix<F> a(150, 120), b(120, 90);
+        for (size_t m = 0; m < 150; ++m)
+            for (size_t n = 0; n < 120; ++n)
+                a.at(m, n) = F(m * 7919 + n * n * 104729 + 1);
+        for (size_t m = 0; m < 120; ++m)
+            for (size_t n = 0; n < 90; ++n)
+                b.at(m, n) = F(m * m * 31 + n * 65537 + 3);
+        const std::pair<Matrix<F>, Matrix<F>> exact = products(a, b, 16);
+        assert_eq(exact.first == exact.second);
+
+        // Scratch memory comes from the bound arena, and is given back
+        maths::Arena workspace(1024);
+        maths::Arena::Bind bind(workspace);
+        assert_eq(check<double>(96, 96, 90, 32));
+        assert_eq(workspace.capacity() > 1024 && workspace.used() == 0);
+
+        results();
+    }
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - structured.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 19, 2026 [5:50 AM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <TriangularMatrix.hpp>
+#include <SymmetricMatrix.hpp>
+#include <BandMatrix.hpp>
+#include <cmath>
+
+template < class K >
+bool close(const Matrix<K>& a, const Matrix<K>& b)
+{
+    if (a.shape() != b.shape())
+        return false;
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            if (std::abs(a.at(m, n) - b.at(m, n)) > 1e-9 * (1 + std::abs(b.at(m, n))))
+                return false;
+    return true;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Triangular");
+
+        const f64Matrix dense = sequence<double>(7, 7, 0, 12);
+        const LowerMatrix<double> l(dense);
+        const UpperMatrix<double> u(dense);
+        const f64Matrix b = sequence<double>(7, 3, 0, 12);
+        const f64Vector v = f64Vector(b.column(1));
+
+        assert_eq(l.values().size() == 28);
+        assert_eq(l.at(2, 1) == dense.at(2, 1) && l.at(1, 2) == 0);
+        assert_eq(u.at(1, 2) == dense.at(1, 2) && u.at(2, 1) == 0);
+        f64Matrix parts = l.to_matrix() + u.to_matrix();
+        parts.diagonal() -= dense.diagonal();
+        assert_eq(parts == dense);
+        assert_eq(close(l * b, l.to_matrix() * b));
+        assert_eq(close(u * b, u.to_matrix() * b));
+        assert_eq(close((l * v).to_matrix(), (l.to_matrix() * v).to_matrix()));
+        assert_eq(close(l * l.solve(b), b));
+        assert_eq(close(u * u.solve(b), b));
+        assert_eq(close((u * solve(u, v)).to_matrix(), v.to_matrix()));
+        assert_eq(std::abs(l.determinant() - l.to_matrix().determinant()) < 1e-6 * std::abs(l.determinant()));
+
+        f64Matrix m = b;
+        u.solve_inplace(m.column(2));
+        assert_eq(close(f64Vector(m.column(2)).to_matrix(), u.solve(b.column(2)).to_matrix()));
+
+        LowerMatrix<double> singular(3, 1);
+        singular(1, 1) = 0;
+        assert_eq(throws<std::runtime_error>([&]() { singular.solve(f64Vector(3)); }));
+        assert_eq(throws<std::logic_error>([&]() { l * f64Vector(3); }));
+        assert_eq(throws<std::logic_error>([]() { LowerMatrix<double>(f64Matrix(2, 3)); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Symmetric");
+
+        const f64Matrix a = sequence<double>(9, 5, 0, 12);
+        const f64Matrix gram = a * a.transpose();
+        const SymmetricMatrix<double> s(gram);
+        const f64Matrix b = sequence<double>(9, 4, 0, 12);
+
+        assert_eq(s.values().size() == 45);
+        assert_eq(s.to_matrix() == gram);
+        assert_eq(s(2, 7) == s(7, 2) && &s(2, 7) == &s(7, 2));
+        assert_eq(close(s * b, gram * b));
+        assert_eq(close((s * f64Vector(b.column(0))).to_matrix(), (gram * f64Vector(b.column(0))).to_matrix()));
+
+        SymmetricMatrix<double> t(3);
+        t.at(0, 2) = 5;
+        assert_eq(t.at(2, 0) == 5);
+        assert_eq(throws<std::out_of_range>([&]() { t.at(3, 0); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Banded");
+
+        // Tridiagonal stencil, with an extra diagonal above for asymmetry
+        const size_t size = 200;
+        BandMatrix<double> a(size, 1, 2);
+        for (size_t m = 0; m < size; ++m)
+            for (size_t n = a.first(m); n < a.last(m); ++n)
+                a(m, n) = m == n ? 2. + 1. / static_cast<double>(m + 1) : n < m ? -1. : n == m + 1 ? -1. : .25;
+        const f64Matrix dense = a.to_matrix();
+        const f64Matrix b = sequence<double>(size, 3, 0, 12);
+
+        assert_eq(a.at(5, 3) == 0 && a.at(5, 4) == -1 && a.at(5, 7) == .25 && a.at(5, 8) == 0);
+        assert_eq(BandMatrix<double>(dense, 1, 2).to_matrix() == dense);
+        assert_eq(close(a * b, dense * b));
+        assert_eq(close((a * f64Vector(b.column(1))).to_matrix(), (dense * f64Vector(b.column(1))).to_matrix()));
+
+        const BandLU<double> lu = a.lu();
+        assert_eq(!lu.singular());
+        assert_eq(close(dense * lu.solve(b), b));
+        assert_eq(close(lu.solve(b), solve(dense, b)));
+        assert_eq(close((dense * solve(a, f64Vector(b.column(0)))).to_matrix(), f64Matrix(b.block(0, 0, size, 1))));
+
+        // Pivoting needed: zero on the diagonal
+        const f64Matrix pivoting({ { 0, 1, 0, 0 }, { 2, 1, 3, 0 }, { 0, 4, 1, 5 }, { 0, 0, 6, 1 } });
+        const BandMatrix<double> p(pivoting, 1, 1);
+        assert_eq(close(pivoting * p.lu().solve(b.block(0, 0, 4, 3)), f64Matrix(b.block(0, 0, 4, 3))));
+        assert_eq(std::abs(p.lu().determinant() - pivoting.determinant()) < 1e-9);
+
+        const f64Matrix singular({ { 1, 2, 0 }, { 2, 4, 0 }, { 0, 0, 1 } });
+        assert_eq(BandMatrix<double>(singular, 1, 1).lu().singular());
+        assert_eq(throws<std::runtime_error>([&]() { BandMatrix<double>(singular, 1, 1).lu().solve(f64Vector(3)); }));
+        assert_eq(BandMatrix<double>(singular, 1, 1).lu().determinant() == 0);
+
+        // Badly scaled, but only exactly zero pivots are refused
+        const BandLU<double> scaled = BandMatrix<double>(f64Matrix({ { 1e-20, 1, 0 }, { 0, 1, 2 }, { 0, 0, 1 } }), 1, 1).lu();
+        assert_eq(scaled.singular() && scaled.invertible());
+        assert_feq(scaled.determinant() * 1e20, 1.0);
+        assert_eq(scaled.solve(f64Vector({ 1e-20, 0, 0 })) == f64Vector({ 1, 0, 0 }));
+
+        results();
+    }
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - transpose.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [6:40 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <chrono>
+
+template < class K >
+bool check(const size_t& height, const size_t& width)
+{
+    const Matrix<K> a = sequence<K>(height, width);
+    const Matrix<K> t = a.transpose();
+    if (t.height() != width || t.width() != height)
+        return false;
+    for (size_t m = 0; m < height; ++m)
+        for (size_t n = 0; n < width; ++n)
+            if (t.at(n, m) != a.at(m, n))
+                return false;
+
+    Matrix<K> b = a;
+    b.transpose_inplace();
+    return b == t;
+}
+
+template < class K >
+void report(const char* name, const size_t& size)
+{
+    const Matrix<K> a = sequence<K>(size, size);
+
+    const auto start = std::chrono::steady_clock::now();
+    const Matrix<K> t = a.transpose();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "\033[2m" << name << " " << size << "x" << size << " transpose: "
+              << elapsed.count() * 1e3 << " ms\033[0m" << std::endl;
+}
+
+int main()
+{
+    {
+        title("Tiled transpose");
+
+        assert_eq(check<float>(1, 1));
+        assert_eq(check<float>(8, 8));
+        assert_eq(check<float>(37, 101));
+        assert_eq(check<float>(130, 130));
+        assert_eq(check<double>(4, 4));
+        assert_eq(check<double>(67, 67));
+        assert_eq(check<double>(3, 200));
+        assert_eq(check<int>(99, 99));
+        assert_eq(check<short>(45, 45));
+        assert_eq(check<long double>(33, 34));
+        assert_eq((f32Matrix(0, 3).transpose().shape() == f32Matrix(3, 0).shape()));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Threaded transpose");
+
+        maths::ThreadPool::set_threads(4);
+        assert_eq(check<float>(300, 257));
+        assert_eq(check<double>(513, 513));
+        assert_eq(check<int>(260, 700));
+        maths::ThreadPool::set_threads(0);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        report<float>("f32Matrix", 2048);
+        report<double>("f64Matrix", 2048);
+    }
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+//         .-.
+//   __   /   \   __
+//  (  `'.\   /.'`  )  matrix-cpp - view.cpp
+//   '-._.(;;;)._.-'
+//   .-'  ,`"`,  '-.
+//  (__.-'/   \'-.__)  By: Rosie (https://github.com/BlankRose)
+//      //\   /        Created at: October 18, 2026 [11:30 PM]
+//     ||  '-'
+/* ************************************************************************** */
+
+#include "common.hpp"
+#include <cmath>
+
+template < class K >
+bool close(const Matrix<K>& a, const Matrix<K>& b)
+{
+    if (a.shape() != b.shape())
+        return false;
+    for (size_t m = 0; m < a.height(); ++m)
+        for (size_t n = 0; n < a.width(); ++n)
+            if (std::abs(a.at(m, n) - b.at(m, n)) > 1e-9 * (1 + std::abs(b.at(m, n))))
+                return false;
+    return true;
+}
+
+template < class E, class F >
+bool throws(const F& call)
+{
+    try
+    {
+        call();
+    }
+    catch (const E&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    {
+        title("Views");
+
+        f32Matrix a({ { 0, 1, 2, 3, 4 }, { 5, 6, 7, 8, 9 }, { 10, 11, 12, 13, 14 }, { 15, 16, 17, 18, 19 } });
+        const f32Matrix& c = a;
+
+        assert_eq((f32Matrix(a.block(1, 2, 2, 3)) == f32Matrix({ { 7, 8, 9 }, { 12, 13, 14 } })));
+        assert_eq((a.row(2) == f32Vector({ 10, 11, 12, 13, 14 })));
+        assert_eq((a.column(1) == f32Vector({ 1, 6, 11, 16 })));
+        assert_eq((a.diagonal() == f32Vector({ 0, 6, 12, 18 })));
+        assert_eq((c.block(0, 0, 4, 5) == a));
+        assert_eq((c.block(1, 1, 3, 4).column(2)[1] == 13));
+        assert_eq((a.block(1, 2, 2, 3).transpose() == f32Matrix({ { 7, 12 }, { 8, 13 }, { 9, 14 } })));
+        assert_eq(a.block(4, 5, 0, 0).empty());
+        assert_eq(throws<std::out_of_range>([&]() { a.block(2, 2, 3, 1); }));
+        assert_eq(throws<std::out_of_range>([&]() { a.row(4); }));
+        assert_eq(throws<std::out_of_range>([&]() { c.column(5); }));
+
+        f32Vector v({ 1, 2, 3, 4, 5 });
+        assert_eq((v.segment(1, 3) == f32Vector({ 2, 3, 4 })));
+        assert_eq(v.view().dot(a.row(1)) == 5 * 1 + 6 * 2 + 7 * 3 + 8 * 4 + 9 * 5);
+        assert_eq(a.column(0).dot(f32Vector({ 1, 1, 1, 1 })) == 30);
+        assert_eq(a.row(0).norm_inf() == 4);
+        assert_eq(std::abs(a.diagonal().norm_2() - f32Vector({ 0, 6, 12, 18 }).norm_2()) < 1e-6);
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Writing through views");
+
+        f32Matrix a({ { 0, 1, 2, 3 }, { 4, 5, 6, 7 }, { 8, 9, 10, 11 }, { 12, 13, 14, 15 } });
+        a.block(0, 0, 2, 2) = f32Matrix({ { -1, -2 }, { -3, -4 } });
+        assert_eq((a.row(0) == f32Vector({ -1, -2, 2, 3 })));
+        assert_eq((a.row(1) == f32Vector({ -3, -4, 6, 7 })));
+
+        a.row(3) = a.row(2) + a.row(3) * 2.f;
+        assert_eq((a.row(3) == f32Vector({ 32, 35, 38, 41 })));
+
+        a.column(2) -= a.column(3);
+        assert_eq((a.column(2) == f32Vector({ -1, -1, -1, -3 })));
+
+        a.diagonal().fill(0);
+        assert_eq(a.trace() == 0);
+        a.block(2, 0, 2, 4) *= 2.f;
+        assert_eq((a.row(2) == f32Vector({ 16, 18, 0, 22 })));
+
+        f32Matrix b(2, 2, 1);
+        b.view() += a.block(1, 1, 2, 2);
+        assert_eq((b == f32Matrix({ { 1, 0 }, { 19, 1 } })));
+
+        f32Vector v(3);
+        v.segment(0, 2) = a.diagonal().segment(2, 2);
+        v.view() += f32Vector({ 1, 1, 1 });
+        assert_eq((v == f32Vector({ 1, 1, 1 })));
+
+        assert_eq(throws<std::logic_error>([&]() { a.block(0, 0, 2, 2) = b.block(0, 0, 1, 2); }));
+
+        results();
+    }
+    std::cout << std::endl;
+    {
+        title("Kernels on views");
+
+        const f64Matrix a = sequence<double>(90, 70);
+        const f64Matrix b = sequence<double>(70, 50);
+        const f64Matrix s = a.block(10, 5, 40, 30).transpose();
+        const f64Matrix t = f64Matrix(b.block(3, 7, 40, 20));
+
+        assert_eq(close(a.block(10, 5, 40, 30) * b.block(3, 7, 30, 20),
+                        f64Matrix(a.block(10, 5, 40, 30)) * f64Matrix(b.block(3, 7, 30, 20))));
+        assert_eq(close(s * a.block(0, 0, 40, 10), s * f64Matrix(a.block(0, 0, 40, 10))));
+        assert_eq(close(a.block(0, 0, 20, 40) * t, f64Matrix(a.block(0, 0, 20, 40)) * t));
+        assert_eq((a.block(0, 0, 3, 70) * b.column(4) == f64Matrix(a.block(0, 0, 3, 70)) * f64Vector(b.column(4))));
+        assert_eq(throws<std::logic_error>([&]() { a.view() * a.view(); }));
+
+        f64Matrix m({ { 4, 1, 0, 2, 1 }, { 1, 5, 1, 0, 2 }, { 0, 1, 6, 1, 3 } });
+        const f64Matrix system = f64Matrix(m.block(0, 0, 3, 3));
+        const f64Matrix rhs = f64Matrix(m.block(0, 3, 3, 2));
+        system.lu().solve_inplace(m.block(0, 3, 3, 2));
+        assert_eq(close(f64Matrix(m.block(0, 3, 3, 2)), solve(system, rhs)));
+        assert_eq((f64Matrix(m.block(0, 0, 3, 3)) == system));
+
+        f64Matrix n = system;
+        system.lu().solve_inplace(n.column(1));
+        assert_eq(close(f64Vector(n.column(1)).to_matrix(), solve(system, f64Vector(system.column(1))).to_matrix()));
+
+        results();
+    }
+}